@@ -1,89 +1,265 @@
-#include "Exchange.cpp"
+#include "engine_runtime.cpp"
+#include <cmath>
 
-// Print engine stats for a specific ticker
-void print_stats(const std::string& ticker, const std::shared_ptr<OrderEngine>& engine) 
+// Monte Carlo load generator on EngineRuntime: N generator threads feed
+// the batch API across an arbitrary ticker universe. Every random draw is
+// a counter-based function of (ticker seed, order index), so a ticker's
+// order stream is bit-identical at any thread count - runs are comparable
+// no matter how the work is scheduled.
+
+// Counter-based RNG (SplitMix64 finalizer): stateless, a draw is a pure
+// function of its counter. Distinct draws for one order use the counter
+// lanes (order_index * LANES + lane).
+struct CounterRng
 {
-    std::cout << "=== STATS FOR " << ticker << " ===" << std::endl;
-    std::cout << "CURRENT PRICE: " << engine->get_price() << std::endl;
-    std::cout << "OPEN ORDERS COUNT: " << engine->get_orders_by_status(OrderStatus::OPEN).size() << std::endl;
-    std::cout << "FILLED ORDERS COUNT: " << engine->get_orders_by_status(OrderStatus::FILLED).size() << std::endl;
-    std::cout << "CANCELED ORDERS COUNT: " << engine->get_orders_by_status(OrderStatus::CANCELLED).size() << std::endl;
-    std::cout << "REJECTED ORDERS COUNT: " << engine->get_orders_by_status(OrderStatus::REJECTED).size() << std::endl;
-    std::cout << "=== MARKET DEPTH BIDS ===" << std::endl;
-    auto bids_depth = engine->get_market_depth(OrderSide::BID, 20);
-    for (auto& order: bids_depth)
-        std::cout << " Price: " << order.first << " Quantity: " << order.second << std::endl;
-    std::cout << "=== MARKET DEPTH ASKS ===" << std::endl;
-    auto asks_depth = engine->get_market_depth(OrderSide::ASK, 20);
-    for (auto& order: asks_depth)
-        std::cout << "Price: " << order.first << " Quantity: " << order.second << std::endl;
-    std::cout << "==============================" << std::endl;
-}
+    static constexpr std::uint64_t LANES = 8;
 
+    std::uint64_t seed;
 
-// Monte Carlo Simulation for a single ticker with skew support
-void monte_carlo_simulation
-(const std::shared_ptr<Exchange>& StockExchange, const std::string& ticker, int num_orders, double ipo_price, 
- double ipo_qty, double volatility, double skew) // skew: -1.0 (bearish) to 1.0 (bullish)
-{
-    StockExchange->initialize_stock(ticker, ipo_price, ipo_qty);
-    std::mt19937_64 rng(std::random_device{}());
+    static std::uint64_t mix(std::uint64_t x) noexcept
+    {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    std::uint64_t draw(std::uint64_t order_index, std::uint64_t lane) const noexcept
+    {
+        return mix(seed + order_index * LANES + lane);
+    }
 
-    std::normal_distribution<double> normal_dist(0.0, volatility);
-    std::uniform_real_distribution<double> qty_dist(1, 100);
-    std::uniform_real_distribution<double> offset_dist(-5, 5);
-    std::bernoulli_distribution side_bias(0.5 + skew * 0.5); // skew biases toward BUY if >0
+    // Uniform in [0, 1)
+    double uniform(std::uint64_t order_index, std::uint64_t lane) const noexcept
+    {
+        return static_cast<double>(draw(order_index, lane) >> 11) * 0x1.0p-53;
+    }
 
+    // Standard normal via Box-Muller on two counter lanes
+    double gaussian(std::uint64_t order_index, std::uint64_t lane) const noexcept
+    {
+        const double u1 = uniform(order_index, lane);
+        const double u2 = uniform(order_index, lane + 1);
+        return std::sqrt(-2.0 * std::log(u1 + 0x1.0p-53)) * std::cos(6.283185307179586 * u2);
+    }
+};
+
+struct SimConfig
+{
+    std::size_t num_orders = 10000;    // Orders per ticker
+    Price ipo_price = 100.0;
+    Quantity ipo_qty = 10000;
+    double volatility = 0.05;          // Std-dev of the per-order price move
+    double skew = 0.15;                // -1.0 (bearish) to 1.0 (bullish)
+    double market_probability = 0.5;   // Market vs limit order mix
     double cancel_probability = 0.05;
-    std::uniform_real_distribution<double> cancel_chance(0.0, 1.0);
+    std::size_t price_refresh = 64;    // Orders between top-of-book reads
+    std::size_t flush_interval = 1024; // Orders between batch flushes
+    std::uint64_t seed = 1;            // Global seed, mixed with each ticker's
+};
 
-    for (int i = 0; i < num_orders; ++i) {
-        // Bias order side using skew
-        OrderSide side = side_bias(rng) ? OrderSide::BID : OrderSide::ASK;
-        OrderType type = (rng() % 2 == 0) ? OrderType::MARKET : OrderType::LIMIT;
-        double qty = qty_dist(rng);
+class MonteCarloSim
+{
+public:
+    MonteCarloSim(EngineRuntime& runtime, const SimConfig& config)
+    : runtime_(runtime), config_(config)
+    {}
 
-        // Apply skewed price change
-        double current_price = StockExchange->get_price(ticker);
-        double change = normal_dist(rng);
+    // Register a ticker into the universe. The per-ticker seed hashes the
+    // name, so adding tickers never perturbs the others' streams.
+    bool add_ticker(const std::string& ticker)
+    {
+        const std::size_t capacity = config_.num_orders + 16;
+        if (!runtime_.register_stock(ticker, config_.ipo_price, config_.ipo_qty, capacity))
+            return false;
+        tickers_.push_back({ticker, runtime_.get_ticker_id(ticker),
+                            CounterRng{CounterRng::mix(hash_name(ticker) ^ config_.seed)}});
+        return true;
+    }
 
-        // Apply skew to upward vs downward moves
-        if (change > 0) change *= (1.0 + skew); // upward amplified if bullish
-        else change *= (1.0 - skew);            // downward dampened if bullish
+    // Drive the whole universe with num_threads generator threads. Each
+    // ticker's stream is generated in order by whichever thread claims
+    // it, and engines are independent, so per-ticker results do not
+    // depend on the thread count.
+    void run(std::size_t num_threads)
+    {
+        next_ticker_.store(0, std::memory_order_relaxed);
+        num_threads = std::max<std::size_t>(1, std::min(num_threads, tickers_.size()));
 
-        double price = current_price != -1 ? std::max(0.01, current_price * (1.0 + change) + offset_dist(rng)) : ipo_price;
+        std::vector<std::thread> generators;
+        generators.reserve(num_threads);
+        for (std::size_t t = 0; t < num_threads; ++t)
+            generators.emplace_back([this]() { generate(); });
+        for (auto& generator : generators)
+            generator.join();
 
-        unsigned int order_id;
-        if (type == OrderType::MARKET)
-            order_id = StockExchange->market_order(ticker, side, qty);
-        else
-            order_id = StockExchange->limit_order(ticker, side, price, qty);
+        runtime_.execute_batch(); // Drain whatever the last flushes left behind
+    }
 
-        if (cancel_chance(rng) < cancel_probability)
-            StockExchange->cancel_order(ticker, order_id);
+    // Print engine stats for one ticker (mirrors the old per-engine dump)
+    void print_stats(const std::string& ticker) const
+    {
+        const EngineStats stats = runtime_.get_stats(ticker);
+        const BookTop top = runtime_.get_top_of_book(ticker);
+        std::cout << "=== STATS FOR " << ticker << " ===" << std::endl;
+        std::cout << "LAST TRADE PRICE: " << top.last_trade << std::endl;
+        std::cout << "ORDERS PLACED: " << stats.orders_placed << std::endl;
+        std::cout << "OPEN ORDERS COUNT: " << stats.open_orders << std::endl;
+        std::cout << "FILLED ORDERS COUNT: " << stats.filled_orders << std::endl;
+        std::cout << "CANCELLED ORDERS COUNT: " << stats.orders_cancelled << std::endl;
+        std::cout << "REJECTED ORDERS COUNT: " << stats.orders_rejected << std::endl;
+        std::cout << "TRADES: " << stats.trades << " VOLUME: " << stats.trade_volume << std::endl;
+        std::cout << "=== MARKET DEPTH BIDS ===" << std::endl;
+        for (auto& level : runtime_.get_market_depth(ticker, OrderSide::BID, 20))
+            std::cout << " Price: " << level.first << " Quantity: " << level.second << std::endl;
+        std::cout << "=== MARKET DEPTH ASKS ===" << std::endl;
+        for (auto& level : runtime_.get_market_depth(ticker, OrderSide::ASK, 20))
+            std::cout << " Price: " << level.first << " Quantity: " << level.second << std::endl;
+        std::cout << "==============================" << std::endl;
     }
-}
-// Main function to spawn threads for multiple tickers
-int main() 
-{
-    std::shared_ptr<Exchange> DBSE = std::make_shared<Exchange>(false);
-    std::vector<std::string> tickers = {"AAPL", "TSLA", "AMZN", "NVDA"};
-    std::vector<std::thread> threads;
-
-    for (const auto& ticker : tickers) {
-        threads.emplace_back([=]() {
-            monte_carlo_simulation(DBSE, ticker, 10000, 100.0, 10000, 0.05, 0.15);
-        });
+
+    const std::vector<std::string> ticker_names() const
+    {
+        std::vector<std::string> names;
+        names.reserve(tickers_.size());
+        for (const auto& sim : tickers_)
+            names.push_back(sim.ticker);
+        return names;
+    }
+
+private:
+    struct TickerSim
+    {
+        std::string ticker;
+        TickerId tid;
+        CounterRng rng;
+    };
+
+    // Counter lanes of one order's draws
+    enum : std::uint64_t { SIDE, TYPE, QTY, MOVE, OFFSET, CANCEL };
+
+    static std::uint64_t hash_name(const std::string& name) noexcept
+    {
+        std::uint64_t h = 0xCBF29CE484222325ULL; // FNV-1a
+        for (char c : name)
+        {
+            h ^= static_cast<unsigned char>(c);
+            h *= 0x100000001B3ULL;
+        }
+        return h;
     }
 
-    for (auto& t : threads) {
-        t.join(); // Wait for all simulations to finish
+    // Generator loop: claim tickers off the shared cursor and simulate
+    // each one front to back
+    void generate()
+    {
+        for (;;)
+        {
+            const std::size_t idx = next_ticker_.fetch_add(1, std::memory_order_relaxed);
+            if (idx >= tickers_.size())
+                return;
+            simulate(tickers_[idx]);
+        }
     }
 
-    // Print stats after all threads finish
-    for (const auto& ticker : tickers) {
-        print_stats(ticker, DBSE->get_engine(ticker)); // Assumes Exchange::get_engine(ticker) exists
+    void simulate(const TickerSim& sim)
+    {
+        const CounterRng& rng = sim.rng;
+        const WorkerId worker = runtime_.get_worker(sim.tid);
+
+        // Order ids materialize when batches execute; cancels are held
+        // until the next flush so their targets have resolved
+        std::vector<OrderId> order_ids(config_.num_orders, NULL_ORDER);
+        std::vector<std::size_t> pending_cancels;
+        Price current_price = config_.ipo_price;
+
+        for (std::size_t i = 0; i < config_.num_orders; ++i)
+        {
+            // Batched price read: one top-of-book snapshot per refresh
+            // window instead of a call per order
+            if (i % config_.price_refresh == 0)
+            {
+                const BookTop top = runtime_.get_top_of_book(sim.tid);
+                if (top.last_trade > 0)
+                    current_price = top.last_trade;
+                else if (top.best_bid > 0 && top.best_ask > 0)
+                    current_price = (top.best_bid + top.best_ask) / 2.0;
+            }
+
+            // Bias order side using skew, and amplify moves in its favor
+            const OrderSide side = rng.uniform(i, SIDE) < 0.5 + config_.skew * 0.5
+                ? OrderSide::BID : OrderSide::ASK;
+            double change = rng.gaussian(i, MOVE) * config_.volatility;
+            change *= change > 0 ? (1.0 + config_.skew) : (1.0 - config_.skew);
+
+            const Quantity qty = 1.0 + rng.uniform(i, QTY) * 99.0;
+            const Price price = std::max(0.01,
+                current_price * (1.0 + change) + (rng.uniform(i, OFFSET) - 0.5) * 10.0);
+
+            if (rng.uniform(i, TYPE) < config_.market_probability)
+                runtime_.market_order(sim.tid, side, qty, &order_ids[i], IPO_HOLDER);
+            else
+                runtime_.limit_order(sim.tid, side, price, qty, &order_ids[i], IPO_HOLDER);
+
+            if (rng.uniform(i, CANCEL) < config_.cancel_probability)
+                pending_cancels.push_back(i);
+
+            if ((i + 1) % config_.flush_interval == 0)
+                flush_cancels(sim, worker, order_ids, pending_cancels);
+        }
+
+        flush_cancels(sim, worker, order_ids, pending_cancels);
+    }
+
+    // Drain the ticker's worker so queued ids resolve, then submit the
+    // held cancels (best effort - targets may already be filled)
+    void flush_cancels(const TickerSim& sim, WorkerId worker,
+        const std::vector<OrderId>& order_ids, std::vector<std::size_t>& pending_cancels)
+    {
+        runtime_.execute_batch(worker);
+        for (std::size_t idx : pending_cancels)
+            if (order_ids[idx] != NULL_ORDER)
+                runtime_.cancel_order(sim.tid, order_ids[idx], nullptr, IPO_HOLDER);
+        pending_cancels.clear();
+    }
+
+    EngineRuntime& runtime_;
+    SimConfig config_;
+    std::vector<TickerSim> tickers_;
+    std::atomic<std::size_t> next_ticker_{0};
+};
+
+int main(int argc, char* argv[])
+{
+    const std::size_t num_threads = argc > 1 ? std::stoul(argv[1]) : 4;
+
+    auto& runtime = EngineRuntime::get_instance(4, 100000, 1024, false, true);
+
+    SimConfig config;
+    config.num_orders = 10000;
+    config.ipo_price = 100.0;
+    config.ipo_qty = 1000000; // IPO_HOLDER trades both sides - needs the float
+    config.volatility = 0.05;
+    config.skew = 0.15;
+
+    MonteCarloSim sim(runtime, config);
+    for (const auto& ticker : {"AAPL", "TSLA", "AMZN", "NVDA"})
+        if (!sim.add_ticker(ticker))
+            return 1;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    sim.run(num_threads);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    for (const auto& ticker : sim.ticker_names())
+    {
+        sim.print_stats(ticker);
         std::cout << std::endl;
     }
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    std::cout << "Simulated " << config.num_orders << " orders x "
+              << sim.ticker_names().size() << " tickers on " << num_threads
+              << " generator threads in " << ms << "ms" << std::endl;
     return 0;
 }
@@ -1,198 +1,379 @@
 #pragma once
 #include "order_engine.cpp"
 #include "job_scheduler.cpp"
-#include "../tools/arena.cpp"
+#include "../tools/Arena.cpp"
 #include <unordered_set>
+#include <memory>
+#include <algorithm>
+
+constexpr std::uint64_t RUNTIME_SNAPSHOT_MAGIC = 0x53544E5241544954ULL; // "TITANRTS"
+constexpr std::uint32_t RUNTIME_SNAPSHOT_VERSION = 1;
+
+// Header of a snapshot_all() image. The payload is: the ticker id of
+// each saved engine (ids can have gaps after unregister_stock), each
+// engine's own snapshot image back to back, then the runtime-level user
+// state - order ownership sets and share balances - keyed by those ids.
+struct RuntimeSnapshotHeader
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t engine_count;
+};
+
+// Defined in trading_strategy.cpp (included at the bottom of this file:
+// the example strategies there call back into the full EngineRuntime)
+struct TradingStrategy;
 
 using UserId = std::uint32_t;
 constexpr UserId IPO_HOLDER = 0;  // IPO holder owns all initial shares
 
 using EngineId = std::uint32_t;
-struct OrderEngineInfo
+
+// Dense interned ticker id: order-entry APIs take this instead of a
+// string so the submission path never hashes (or copies) a ticker name.
+using TickerId = std::uint32_t;
+constexpr TickerId INVALID_TICKER = static_cast<TickerId>(-1);
+
+// Generic over the engine instantiation, like the scheduler's jobs; the
+// runtime's OrderEngineInfo alias names the variant it actually holds
+template <typename Engine>
+struct BasicOrderEngineInfo
 {
-    OrderEngine engine_;  // Engine Object
+    Engine engine_;  // Engine Object
     Quantity ipo_shares_; // Intial IPO
     EngineId engine_id_; // Id for Engine
-    WorkerId worker_id_; // Id for Worker
-    std::size_t batch_counter_; // Per-engine auto-batching counter
-    
+    std::atomic<WorkerId> worker_id_; // Owning worker (rebalancing may migrate it)
+    std::atomic<std::size_t> batch_counter_; // Per-engine auto-batching counter (shared by concurrent submitters)
+    std::atomic<std::size_t> rebalance_load_; // Jobs submitted since last rebalance
+
+    // Order id -> submitting user's open-ASK balance counter. Touched only
+    // by the engine's owning worker (jobs and the fill hook both run there)
+    std::vector<std::atomic<Quantity>*> order_balance_;
+
     // Constructor for in-place construction
-    OrderEngineInfo(const std::string& ticker, std::size_t capacity, bool verbose, 
-        Quantity ipo_shares, EngineId engine_id, WorkerId worker_id)
-    :engine_(ticker, capacity, verbose, true),  // auto_match = true
+    BasicOrderEngineInfo(const std::string& ticker, std::size_t capacity, bool verbose,
+        Quantity ipo_shares, EngineId engine_id, WorkerId worker_id, Price tick_size)
+    :engine_(ticker, capacity, verbose, true, tick_size),  // auto_match = true
     ipo_shares_(ipo_shares),
     engine_id_(engine_id),
     worker_id_(worker_id),
-    batch_counter_(0)
-    {}
-};
+    batch_counter_(0),
+    rebalance_load_(0)
+    {
+        order_balance_.reserve(capacity);
+        engine_.attach_fill_hook(&BasicOrderEngineInfo::on_fill, this);
+    }
 
-enum class RequestStatus : std::uint8_t
-{
-    Pending,    // Request has been created but not yet submitted
-    InProgress,     // Request is currently being processed by a worker
-    Completed,      // Request finished successfully and result is available
-    Failed,         // Request finished but encountered an error
-    Cancelled       // Request was cancelled before completion
-};
+    WorkerId worker() const noexcept { return worker_id_.load(std::memory_order_relaxed); }
 
-// Different Request Types
-enum class ResultKind : std::uint8_t 
-{
-    None,
-    OrderId,
-    Price,
-    Bool,
+    // Fill hook: a filled ASK order's shares are no longer sellable, so
+    // debit them from the placing user's balance. Runs on the matching
+    // path, on the engine's owning worker (the balance's single writer).
+    static void on_fill(void* ctx, OrderId id, OrderSide side, Quantity qty) noexcept
+    {
+        if (side != OrderSide::ASK)
+            return;
+        auto* info = static_cast<BasicOrderEngineInfo*>(ctx);
+        if (id < info->order_balance_.size() && info->order_balance_[id])
+        {
+            std::atomic<Quantity>* balance = info->order_balance_[id];
+            balance->store(balance->load(std::memory_order_relaxed) - qty,
+                           std::memory_order_relaxed);
+        }
+    }
 };
 
-struct RequestRecord 
+using RequestArena = Arena<RequestRecord>;
+
+// Point-in-time statistics for one ticker: the engine's hot-path counters
+// plus the counters of the worker that currently owns it. Plain values -
+// the snapshot stays valid after the engines move on.
+struct EngineStats
 {
-    std::atomic<bool> ready;
-    ResultKind kind;       
-    RequestStatus status; 
-
-    union { // Union Types
-        OrderId   order_id;    
-        Price     price;       
-        bool      ok;          
-    } result;
+    std::uint64_t orders_placed = 0;
+    std::uint64_t orders_matched = 0;
+    std::uint64_t orders_cancelled = 0;
+    std::uint64_t orders_rejected = 0;
+    std::uint64_t trades = 0;
+    std::uint64_t match_iterations = 0;
+    Quantity trade_volume = 0.0;
+    std::size_t open_orders = 0;   // Orders currently resting (O(1) status count)
+    std::size_t filled_orders = 0; // Orders fully filled so far
+    std::size_t bid_levels = 0;
+    std::size_t ask_levels = 0;
+    WorkerId worker = 0;
+    WorkerStats worker_stats;
 };
 
-using RequestId = std::uint32_t;
-using RequestArena = Arena<RequestRecord>;
-using RequestMap = std::unordered_map<RequestId, RequestArena::Index>;
-
+// Future-style handle to a submitted request. The record lives in the
+// runtime's arena and is recycled in batches once the worker has published
+// the result AND the handle has been dropped - so results can never dangle
+// the way the raw OrderId*/bool* out-parameters could.
 template <typename T>
-class RequestHandle 
+class RequestHandle
 {
 public:
+    RequestHandle() noexcept : record_(nullptr) {}
+
+    RequestHandle(const RequestHandle&) = delete;
+    RequestHandle& operator=(const RequestHandle&) = delete;
+
+    RequestHandle(RequestHandle&& other) noexcept : record_(other.record_)
+    {
+        other.record_ = nullptr;
+    }
+
+    RequestHandle& operator=(RequestHandle&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            record_ = other.record_;
+            other.record_ = nullptr;
+        }
+        return *this;
+    }
+
+    ~RequestHandle() { release(); }
+
+    // True if the request was accepted for execution
+    bool valid() const noexcept { return record_ != nullptr; }
+
+    // Non-blocking: has the worker published the result yet?
     bool ready() const noexcept
     {
-        return record_->ready.load(std::memory_order_acquire);
+        return record_ && record_->ready.load(std::memory_order_acquire);
+    }
+
+    // Block (yield-spin, like the scheduler) until the result is published
+    void wait() const noexcept
+    {
+        if (!record_) return;
+        while (!record_->ready.load(std::memory_order_acquire))
+            std::this_thread::yield();
+    }
+
+    RequestStatus status() const noexcept
+    {
+        if (!record_) return RequestStatus::Failed;
+        return ready() ? record_->status : RequestStatus::Pending;
     }
 
-    const T& value() const noexcept
+    // Wait for and return the result
+    T get() const noexcept
     {
-        // caller responsibility: check ready()
-        return record_->result;
+        wait();
+        if (!record_) return T{};
+        if constexpr (std::is_same_v<T, bool>)
+            return record_->result.ok;
+        else if constexpr (std::is_same_v<T, Price>)
+            return record_->result.price;
+        else
+            return record_->result.order_id;
     }
 
 private:
-    friend class EngineRuntime;
-    explicit RequestHandle(RequestRecord<T>* rec)
+    template <typename, typename> friend class BasicEngineRuntime;
+    explicit RequestHandle(RequestRecord* rec) noexcept
         : record_(rec) {}
 
-    RequestRecord<T>* record_;
-};
+    // Mark the record recyclable; the runtime frees it at a batch boundary
+    void release() noexcept
+    {
+        if (record_)
+        {
+            record_->released.store(true, std::memory_order_release);
+            record_ = nullptr;
+        }
+    }
 
+    RequestRecord* record_;
+};
 
-using EngineMap = std::unordered_map<std::string, OrderEngineInfo>;
+// Type alias for user order tracking: user -> ticker id -> order set.
+// Nested unordered_map so the per-(user, ticker) sets are node-stable:
+// jobs carry a pointer to the set resolved at submission time.
+using UserOrderMap = std::unordered_map<UserId, std::unordered_map<TickerId, std::unordered_set<OrderId>>>;
 
-// Job parameters for order operations
-struct OrderJobArgs
+// Ownership-tracking policies: the user -> ticker -> order-id bookkeeping
+// behind get_positions(). TrackedOwnership is today's behavior - a hash
+// insert per placed order; UntrackedOwnership drops the map and the
+// inserts entirely for headless sweeps that never ask who owns an order.
+// Share balances are not part of the policy: ASK-side validation needs
+// them for correctness, tracked or not.
+struct TrackedOwnership
 {
-    OrderEngine* engine;  // Raw pointer - safe because engine lifetime > job lifetime
-    OrderSide side;
-    OrderType type;
-    Price price;
-    Quantity qty;
-    OrderId order_id;
-    UserId user_id;
-    OrderId* result_id;
-    bool* result_bool;
+    static constexpr bool kEnabled = true;
+    UserOrderMap orders_;
 };
 
-using ArgsArena = Arena<OrderJobArgs>;
+struct UntrackedOwnership
+{
+    static constexpr bool kEnabled = false;
+};
 
-// Type alias for user order tracking
-using UserOrderMap = std::unordered_map<UserId, std::unordered_map<std::string, std::unordered_set<OrderId>>>;
+// One order of a submit_orders() batch (see BATCH_API.md)
+struct OrderRequest
+{
+    TickerId tid = INVALID_TICKER;
+    OrderSide side = OrderSide::BID;
+    OrderType type = OrderType::LIMIT;
+    Price price = 0;               // Ignored for market orders
+    Quantity qty = 0;
+    UserId user = 1;
+    OrderId* result_id = nullptr;  // NULL_ORDER is written on rejection
+};
 
-class EngineRuntime
+template <typename OwnershipPolicy = TrackedOwnership, typename Engine = OrderEngine>
+class BasicEngineRuntime
 {
 public:
+    // The runtime, its engine table and its scheduler all agree on one
+    // engine instantiation (see the EngineRuntime / HeadlessEngineRuntime
+    // aliases below the class)
+    using OrderEngineInfo = BasicOrderEngineInfo<Engine>;
+    using JobScheduler = BasicJobScheduler<Engine>;
+    using Job = typename JobScheduler::Job;
+    using OrderJobArgs = BasicOrderJobArgs<Engine>;
+    using BatchOrderJobArgs = BasicBatchOrderJobArgs<Engine>;
+
     // Delete copy constructor and assignment operator
-    EngineRuntime(const EngineRuntime&) = delete;
-    EngineRuntime& operator=(const EngineRuntime&) = delete;
-    
-    // Singleton instance accessor
-    static EngineRuntime& get_instance(std::size_t num_threads = 1, std::size_t default_capacity = 32768, std::size_t batch_size = 0, bool _verbose = true, bool blocking = true)
+    BasicEngineRuntime(const BasicEngineRuntime&) = delete;
+    BasicEngineRuntime& operator=(const BasicEngineRuntime&) = delete;
+
+    // Singleton instance accessor. num_threads == 0 selects inline mode:
+    // no workers are started and every order-entry call runs place_order
+    // directly on the caller's thread - same API, same result delivery,
+    // none of the enqueue/flush/dequeue cost. That is the right shape for
+    // single-ticker parameter sweeps, where crossing a thread boundary
+    // costs more than the matching itself.
+    static BasicEngineRuntime& get_instance(std::size_t num_threads = 1, std::size_t default_capacity = 32768, std::size_t batch_size = 0, bool _verbose = true, bool blocking = true, bool pin_workers = false)
     {
-        static EngineRuntime instance(num_threads, default_capacity, batch_size, _verbose, blocking);
+        static BasicEngineRuntime instance(num_threads, default_capacity, batch_size, _verbose, blocking, pin_workers);
         return instance;
     }
-    
-    // Register a new stock in the exchange
-    bool register_stock(const std::string& _ticker, Price _ipo_price, Quantity _ipo_qty, std::size_t capacity = 0)
+
+    // Direct construction for sweep harnesses that want one inline runtime
+    // per coordinating thread instead of the shared singleton
+    BasicEngineRuntime(std::size_t num_threads, std::size_t default_capacity = 32768, std::size_t batch_size = 0, bool _verbose = true, bool blocking = true, bool pin_workers = false)
+    : num_workers_(num_threads == 0 ? 1 : num_threads), // Keeps worker-id math valid in inline mode
+      default_capacity_(default_capacity),
+      verbose_(_verbose),
+      batch_size_(batch_size > 0 ? batch_size : default_capacity),
+      scheduler_(num_threads, batch_size > 0 ? batch_size : default_capacity, pin_workers),
+      request_arena_((batch_size > 0 ? batch_size : default_capacity) * 2),
+      next_engine_id_(0),
+      rebalance_interval_(64),
+      batches_since_rebalance_(0),
+      inline_mode_(num_threads == 0),
+      blocking_mode_(blocking)
+    {}
+
+    // Register a new stock and return its dense TickerId
+    TickerId register_ticker(const std::string& _ticker, Price _ipo_price, Quantity _ipo_qty, std::size_t capacity = 0, Price tick_size = 0.01)
     {
         try
         {
             // IF ipo price or qty is less than or equal to 0
             if (_ipo_price <= 0.0 || _ipo_qty <= 0.0)
                 throw std::runtime_error("IPO Price/Quantity must be > 0");
+            // Tick size must be positive
+            if (tick_size <= 0.0)
+                throw std::runtime_error("Tick Size must be > 0");
             // If ticker is already in Exchange then error
-            if (stock_exchange_.find(_ticker) != stock_exchange_.end())
+            if (ticker_ids_.find(_ticker) != ticker_ids_.end())
                 throw std::runtime_error("Stock Already Exist");
 
-            // Use provided capacity or default
-            std::size_t engine_capacity = capacity > 0 ? capacity : default_capacity_;
-            auto engine = std::make_shared<OrderEngine>(_ticker, engine_capacity, verbose_);
-            
+            // Use provided capacity or default (+1: the IPO seed order below consumes a slot)
+            std::size_t engine_capacity = (capacity > 0 ? capacity : default_capacity_) + 1;
+
             // Assign engine ID for job routing
             EngineId engine_id = next_engine_id_++;
 
-            // Construct OrderEngineInfo directly in the map
-            auto [it, inserted] = stock_exchange_.emplace(
-                std::piecewise_construct,
-                std::forward_as_tuple(_ticker),
-                std::forward_as_tuple(_ticker, engine_capacity, verbose_, _ipo_qty, 
-                                      engine_id, engine_id % num_workers_)
-            );
-            
+            // New dense id = next slot in the engine table
+            TickerId tid = static_cast<TickerId>(stock_exchange_.size());
+            stock_exchange_.push_back(std::make_unique<OrderEngineInfo>(
+                _ticker, engine_capacity, verbose_, _ipo_qty,
+                engine_id, engine_id % num_workers_, tick_size));
+            ticker_ids_.emplace(_ticker, tid);
+
+            // Wire the engine into the event journal if one is enabled
+            if (journal_)
+                stock_exchange_[tid]->engine_.attach_journal(journal_->create_ring(), tid);
+
+            // Wire the engine into the candle aggregator if one is enabled
+            if (candles_)
+                wire_candles(tid);
+
             // Place initial sell at IPO Price and IPO Quantity (from IPO holder)
-            OrderId ipo_order = it->second.engine_.place_order(OrderSide::ASK, OrderType::LIMIT, _ipo_price, _ipo_qty);
-            
-            // Track IPO order ownership
-            user_orders_[IPO_HOLDER][_ticker].insert(ipo_order);
-            
-            if (verbose_)
-                std::cout << "[RUNTIME] Registered " << _ticker << " with IPO: " 
-                          << _ipo_qty << " shares @ $" << _ipo_price 
+            OrderId ipo_order = stock_exchange_[tid]->engine_.place_order(OrderSide::ASK, OrderType::LIMIT, _ipo_price, _ipo_qty);
+
+            // Track IPO order ownership and seed the IPO holder's balance
+            if constexpr (OwnershipPolicy::kEnabled)
+                user_ticker_orders(IPO_HOLDER, tid).insert(ipo_order);
+            std::atomic<Quantity>* ipo_balance = user_balance(IPO_HOLDER, tid);
+            ipo_balance->store(_ipo_qty, std::memory_order_relaxed);
+            stock_exchange_[tid]->order_balance_.resize(ipo_order + 1, nullptr);
+            stock_exchange_[tid]->order_balance_[ipo_order] = ipo_balance;
+
+            if (verbose_)
+                std::cout << "[RUNTIME] Registered " << _ticker << " (id " << tid << ") with IPO: "
+                          << _ipo_qty << " shares @ $" << _ipo_price
                           << " (owned by user " << IPO_HOLDER << ")" << std::endl;
-            
-            return true;
+
+            return tid;
         }
         catch(const std::exception& e)
         {
             if (verbose_)
                 std::cerr << "Stock Registration Error: " << e.what() << '\n';
-            return false;
+            return INVALID_TICKER;
         }
     }
-    
+
+    // Register a new stock in the exchange (string compatibility wrapper)
+    bool register_stock(const std::string& _ticker, Price _ipo_price, Quantity _ipo_qty, std::size_t capacity = 0, Price tick_size = 0.01)
+    {
+        return register_ticker(_ticker, _ipo_price, _ipo_qty, capacity, tick_size) != INVALID_TICKER;
+    }
+
+    // Look up the interned id for a ticker (INVALID_TICKER if unknown)
+    TickerId get_ticker_id(const std::string& _ticker) const noexcept
+    {
+        auto it = ticker_ids_.find(_ticker);
+        return it == ticker_ids_.end() ? INVALID_TICKER : it->second;
+    }
+
     // Unregister a stock from the exchange
     bool unregister_stock(const std::string& _ticker)
     {
         try
         {
-            // Find the stock once and reuse the iterator
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end())
+            TickerId tid = get_ticker_id(_ticker);
+            if (tid == INVALID_TICKER)
                 throw std::runtime_error("Stock Does Not Exist");
 
-            auto& engine_info = it->second;
+            auto& engine_info = *stock_exchange_[tid];
+
+            // Wait for worker to finish batch (inline mode has no workers
+            // and nothing in flight)
+            if (!inline_mode_)
+                scheduler_.process_jobs_on(engine_info.worker());
+            // Retire the engine slot (ids stay dense and stable)
+            stock_exchange_[tid].reset();
+            ticker_ids_.erase(_ticker);
+
+            // Erase all user orders and balances for this ticker
+            if constexpr (OwnershipPolicy::kEnabled)
+                for (auto& [user_id, user_tickers] : ownership_.orders_)
+                    user_tickers.erase(tid);
+            for (auto& [user_id, balances] : share_balances_)
+                if (tid < balances.size())
+                    balances[tid].reset();
 
-            // Wait for worker to finish batch
-            scheduler_.process_jobs_on(engine_info.worker_id_);
-            // Erase stock from exchange
-            stock_exchange_.erase(_ticker);
-            
-            // Erase all user orders for this ticker
-            for (auto& [user_id, user_tickers] : user_orders_)
-                user_tickers.erase(_ticker);
-            
             if (verbose_)
                 std::cout << "[RUNTIME] Unregistered " << _ticker << std::endl;
-            
+
             return true;
         }
         catch(const std::exception& e)
@@ -202,7 +383,7 @@ public:
             return false;
         }
     }
-    
+
     // Reset the entire runtime state (allows reusing stock names and changing parameters)
     void reset()
     {
@@ -210,15 +391,24 @@ public:
         {
             scheduler_.process_jobs(); // Wait for pending jobs
             stock_exchange_.clear(); // Clear Stocks
-            user_orders_.clear(); // Clear User Orders
-            
+            ticker_ids_.clear(); // Clear Interned Ids
+            if constexpr (OwnershipPolicy::kEnabled)
+                ownership_.orders_.clear(); // Clear User Orders
+            share_balances_.clear(); // Clear Share Balances
+            pending_requests_.clear(); // Clear Request Records
+            request_arena_.reset();
+
+            {
+                // Drop strategy subscriptions and their rings (the engines
+                // holding ring pointers were just destroyed above)
+                std::lock_guard<std::mutex> lock(strategies_mutex_);
+                strategies_.clear();
+                strategy_rings_.clear();
+            }
+
             // Reset counters
             next_engine_id_ = 0;
-            
-            // Clear arenas (free all allocated slots)
-            for (auto& arena : worker_arenas_)
-                arena.reset();
-            
+
             if (verbose_)
                 std::cout << "[RUNTIME] Reset complete - all stocks and orders cleared" << std::endl;
         }
@@ -229,72 +419,54 @@ public:
         }
     }
 
-    void limit_order(const std::string& _ticker, OrderSide _side, Price _price, Quantity _qty, OrderId* result_id_ptr, UserId user_id = 1)
+    void limit_order(TickerId _tid, OrderSide _side, Price _price, Quantity _qty, OrderId* result_id_ptr, UserId user_id = 1)
+    {
+        limit_order_impl(_tid, _side, _price, _qty, user_id, result_id_ptr, nullptr);
+    }
+
+private:
+    void limit_order_impl(TickerId _tid, OrderSide _side, Price _price, Quantity _qty, UserId user_id, OrderId* result_id_ptr, RequestRecord* record)
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end()) 
+            OrderEngineInfo* info = find_stock(_tid);
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
             if (_price <= 0 || _qty <= 0)
                 throw std::runtime_error("Price/Quantity must be > 0");
-            
+
             // VALIDATE OWNERSHIP BEFORE SUBMITTING
             if (_side == OrderSide::ASK)
             {
-                if (!has_sufficient_shares(user_id, _ticker, _qty))
+                if (!has_sufficient_shares(user_id, _tid, _qty))
                 {
-                    std::string err_msg = "User " + std::to_string(user_id) + 
+                    std::string err_msg = "User " + std::to_string(user_id) +
                                          " does not have sufficient shares to sell " + std::to_string(_qty);
                     throw std::runtime_error(err_msg);
                 }
             }
-            
-            auto& engine_info = it->second;
-            auto& arena = worker_arenas_[engine_info.worker_id_];
-            OrderEngine* engine_ptr = &it->second.engine_;
-
-            auto args_idx = arena.emplace(OrderJobArgs{
-                engine_ptr, _side, OrderType::LIMIT,
-                _price, _qty, 0, user_id, result_id_ptr, nullptr
-            });
-            
-            // Check if arena is full BEFORE accessing arena[args_idx]
-            if (args_idx == static_cast<Arena<OrderJobArgs>::Index>(-1))
-                throw std::runtime_error("Arena overflow - increase batch_size or arena capacity");
-            
-            // Capture arena pointer and args_idx - no heap allocation needed!
-            auto arena_ptr = &arena;
-            
-            // Capture this for user_orders_ access
-            auto* runtime = this;
-            
-            Job job(
-                // Execute lambda
-                [arena_ptr, args_idx, runtime, _ticker]() {
-                    auto* params = &(*arena_ptr)[args_idx];
-                    OrderId order_id = params->engine->place_order(params->side, params->type, params->price, params->qty);
-                    *(params->result_id) = order_id;
-                    
-                    // Track order ownership
-                    if (order_id != static_cast<OrderId>(-1))
-                        runtime->user_orders_[params->user_id][_ticker].insert(order_id);
-                },
-                // Cleanup lambda
-                [arena_ptr, args_idx]() {
-                    arena_ptr->free(args_idx);
-                },
-                engine_info.engine_id_
-            );
-            
-            scheduler_.submit_job(std::move(job));
-            
-            // Increment per-engine batch counter and auto-execute batch if needed
-            engine_info.batch_counter_ += 1;
-            if (engine_info.batch_counter_ >= batch_size_)
+
+            auto& engine_info = *info;
+
+            // Build the job payload inline - nothing allocated per order
+            OrderJobArgs args{
+                &engine_info.engine_, _side, OrderType::LIMIT,
+                _price, _qty, 0, result_id_ptr, nullptr,
+                owner_set(user_id, _tid), record,
+                user_balance(user_id, _tid), &engine_info.order_balance_
+            };
+
+            submit_or_run(Job(JobOp::PlaceLimit, args, engine_info.engine_id_), engine_info);
+            engine_info.rebalance_load_.fetch_add(1, std::memory_order_relaxed);
+
+            // Increment per-engine batch counter and auto-execute batch if
+            // needed. fetch_add keeps concurrent submitters race-free, and
+            // exactly one of them - the one whose add crosses the threshold -
+            // runs the batch
+            if (engine_info.batch_counter_.fetch_add(1, std::memory_order_acq_rel) + 1 == batch_size_)
             {
-                execute_batch(engine_info.worker_id_);
-                engine_info.batch_counter_ = 0;
+                execute_batch(engine_info.worker());
+                engine_info.batch_counter_.store(0, std::memory_order_relaxed);
             }
         }
         catch(const std::exception& e)
@@ -302,72 +474,64 @@ public:
             if (verbose_)
                 std::cerr << "Place Order Error: " << e.what() << '\n';
             if (result_id_ptr) *result_id_ptr = static_cast<OrderId>(-1);
+            fail_request(record);
         }
     }
 
-    void market_order(const std::string& _ticker, OrderSide _side, Quantity _qty, OrderId* result_id_ptr, UserId user_id = 1)
+public:
+    void limit_order(const std::string& _ticker, OrderSide _side, Price _price, Quantity _qty, OrderId* result_id_ptr, UserId user_id = 1)
+    {
+        limit_order(get_ticker_id(_ticker), _side, _price, _qty, result_id_ptr, user_id);
+    }
+
+    void market_order(TickerId _tid, OrderSide _side, Quantity _qty, OrderId* result_id_ptr, UserId user_id = 1)
+    {
+        market_order_impl(_tid, _side, _qty, user_id, result_id_ptr, nullptr);
+    }
+
+private:
+    void market_order_impl(TickerId _tid, OrderSide _side, Quantity _qty, UserId user_id, OrderId* result_id_ptr, RequestRecord* record)
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end()) 
+            OrderEngineInfo* info = find_stock(_tid);
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
             if (_qty <= 0)
                 throw std::runtime_error("Quantity must be > 0");
-            
+
             // VALIDATE OWNERSHIP BEFORE SUBMITTING (like Robinhood)
             if (_side == OrderSide::ASK)
             {
-                if (!has_sufficient_shares(user_id, _ticker, _qty))
+                if (!has_sufficient_shares(user_id, _tid, _qty))
                 {
-                    std::string err_msg = "User " + std::to_string(user_id) + 
+                    std::string err_msg = "User " + std::to_string(user_id) +
                                          " does not have sufficient shares to sell " + std::to_string(_qty);
                     throw std::runtime_error(err_msg);
                 }
             }
-            
-            auto& engine_info = it->second;
-            auto& arena = worker_arenas_[engine_info.worker_id_];
-            OrderEngine* engine_ptr = &it->second.engine_;
-
-            auto args_idx = arena.emplace(OrderJobArgs{
-                engine_ptr, _side, OrderType::MARKET,
-                -1, _qty, 0, user_id, result_id_ptr, nullptr
-            });
-            
-            // Check if arena is full
-            if (args_idx == static_cast<Arena<OrderJobArgs>::Index>(-1))
-                throw std::runtime_error("Arena overflow - increase batch_size or arena capacity");
-            
-            auto arena_ptr = &arena;
-            
-            // Capture this for user_orders_ access
-            auto* runtime = this;
-            
-            Job job(
-                [arena_ptr, args_idx, runtime, _ticker]() {
-                    auto* params = &(*arena_ptr)[args_idx];
-                    OrderId order_id = params->engine->place_order(params->side, params->type, params->price, params->qty);
-                    *(params->result_id) = order_id;
-                    
-                    // Track order ownership
-                    if (order_id != static_cast<OrderId>(-1))
-                        runtime->user_orders_[params->user_id][_ticker].insert(order_id);
-                },
-                [arena_ptr, args_idx]() {
-                    arena_ptr->free(args_idx);
-                },
-                engine_info.engine_id_
-            );
-            
-            scheduler_.submit_job(std::move(job));
-            
-            // Increment per-engine batch counter and auto-execute batch if needed
-            engine_info.batch_counter_ += 1;
-            if (engine_info.batch_counter_ >= batch_size_)
+
+            auto& engine_info = *info;
+
+            // Build the job payload inline - nothing allocated per order
+            OrderJobArgs args{
+                &engine_info.engine_, _side, OrderType::MARKET,
+                -1, _qty, 0, result_id_ptr, nullptr,
+                owner_set(user_id, _tid), record,
+                user_balance(user_id, _tid), &engine_info.order_balance_
+            };
+
+            submit_or_run(Job(JobOp::PlaceMarket, args, engine_info.engine_id_), engine_info);
+            engine_info.rebalance_load_.fetch_add(1, std::memory_order_relaxed);
+
+            // Increment per-engine batch counter and auto-execute batch if
+            // needed. fetch_add keeps concurrent submitters race-free, and
+            // exactly one of them - the one whose add crosses the threshold -
+            // runs the batch
+            if (engine_info.batch_counter_.fetch_add(1, std::memory_order_acq_rel) + 1 == batch_size_)
             {
-                execute_batch(engine_info.worker_id_);
-                engine_info.batch_counter_ = 0;
+                execute_batch(engine_info.worker());
+                engine_info.batch_counter_.store(0, std::memory_order_relaxed);
             }
         }
         catch(const std::exception& e)
@@ -375,222 +539,530 @@ public:
             if (verbose_)
                 std::cerr << "Place Order Error: " << e.what() << '\n';
             if (result_id_ptr) *result_id_ptr = static_cast<OrderId>(-1);
+            fail_request(record);
         }
     }
 
-    void cancel_order(const std::string& _ticker, OrderId order_id, bool* result_ptr, UserId user_id = 1)
+public:
+    void market_order(const std::string& _ticker, OrderSide _side, Quantity _qty, OrderId* result_id_ptr, UserId user_id = 1)
+    {
+        market_order(get_ticker_id(_ticker), _side, _qty, result_id_ptr, user_id);
+    }
+
+    // Stop order: _trigger is the trigger price, not a resting price - the
+    // order waits in the engine's trigger ladder and executes as a market
+    // order once the last trade reaches it
+    void stop_order(TickerId _tid, OrderSide _side, Price _trigger, Quantity _qty, OrderId* result_id_ptr, UserId user_id = 1)
+    {
+        stop_order_impl(_tid, _side, _trigger, _qty, user_id, result_id_ptr, nullptr);
+    }
+
+private:
+    void stop_order_impl(TickerId _tid, OrderSide _side, Price _trigger, Quantity _qty, UserId user_id, OrderId* result_id_ptr, RequestRecord* record)
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end()) 
+            OrderEngineInfo* info = find_stock(_tid);
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
+            if (_trigger <= 0 || _qty <= 0)
+                throw std::runtime_error("Trigger/Quantity must be > 0");
 
-            auto& engine_info = it->second;
-            auto& arena = worker_arenas_[engine_info.worker_id_];
-            OrderEngine* engine_ptr = &it->second.engine_;
-
-            auto args_idx = arena.emplace(OrderJobArgs{
-                engine_ptr, OrderSide::BID, OrderType::LIMIT,
-                0, 0, order_id, user_id, nullptr, result_ptr
-            });
-            
-            // Check if arena is full
-            if (args_idx == static_cast<Arena<OrderJobArgs>::Index>(-1))
-                throw std::runtime_error("Arena overflow - increase batch_size or arena capacity");
-            
-            auto arena_ptr = &arena;
-            
-            // Capture this for user_orders_ access and ticker for cleanup
-            auto* runtime = this;
-            
-            Job job(
-                [arena_ptr, args_idx, runtime, _ticker]() {
-                    auto* params = &(*arena_ptr)[args_idx];
-                    *(params->result_bool) = params->engine->cancel_order(params->order_id);
-                    
-                    // Remove order from tracking if cancel was successful
-                    if (*(params->result_bool))
-                    {
-                        runtime->user_orders_[params->user_id][_ticker].erase(params->order_id);
-                    }
-                },
-                [arena_ptr, args_idx]() {
-                    arena_ptr->free(args_idx);
-                },
-                engine_info.engine_id_
-            );
-            
-            scheduler_.submit_job(std::move(job));
-            
-            // Increment per-engine batch counter and auto-execute batch if needed
-            engine_info.batch_counter_ += 1;
-            if (engine_info.batch_counter_ >= batch_size_)
+            // VALIDATE OWNERSHIP BEFORE SUBMITTING - the shares are
+            // committed while the stop waits in the ladder
+            if (_side == OrderSide::ASK)
+            {
+                if (!has_sufficient_shares(user_id, _tid, _qty))
+                {
+                    std::string err_msg = "User " + std::to_string(user_id) +
+                                         " does not have sufficient shares to sell " + std::to_string(_qty);
+                    throw std::runtime_error(err_msg);
+                }
+            }
+
+            auto& engine_info = *info;
+
+            // Build the job payload inline - nothing allocated per order
+            OrderJobArgs args{
+                &engine_info.engine_, _side, OrderType::STOP,
+                _trigger, _qty, 0, result_id_ptr, nullptr,
+                owner_set(user_id, _tid), record,
+                user_balance(user_id, _tid), &engine_info.order_balance_
+            };
+
+            submit_or_run(Job(JobOp::PlaceLimit, args, engine_info.engine_id_), engine_info);
+            engine_info.rebalance_load_.fetch_add(1, std::memory_order_relaxed);
+
+            // Increment per-engine batch counter and auto-execute batch if
+            // needed. fetch_add keeps concurrent submitters race-free, and
+            // exactly one of them - the one whose add crosses the threshold -
+            // runs the batch
+            if (engine_info.batch_counter_.fetch_add(1, std::memory_order_acq_rel) + 1 == batch_size_)
             {
-                execute_batch(engine_info.worker_id_);
-                engine_info.batch_counter_ = 0;
+                execute_batch(engine_info.worker());
+                engine_info.batch_counter_.store(0, std::memory_order_relaxed);
             }
         }
         catch(const std::exception& e)
         {
             if (verbose_)
-                std::cerr << "Cancel Order Error: " << e.what() << '\n';
-            if (result_ptr) *result_ptr = false;
+                std::cerr << "Place Order Error: " << e.what() << '\n';
+            if (result_id_ptr) *result_id_ptr = static_cast<OrderId>(-1);
+            fail_request(record);
         }
     }
 
-    void edit_order(const std::string& _ticker, OrderId order_id, OrderSide _side, Price _price, Quantity _qty, OrderId* result_id_ptr)
+public:
+    void stop_order(const std::string& _ticker, OrderSide _side, Price _trigger, Quantity _qty, OrderId* result_id_ptr, UserId user_id = 1)
+    {
+        stop_order(get_ticker_id(_ticker), _side, _trigger, _qty, result_id_ptr, user_id);
+    }
+
+    // Iceberg order: _qty is the total, _display the visible slice that
+    // rests in the book (the engine refills it in place as slices fill)
+    void iceberg_order(TickerId _tid, OrderSide _side, Price _price, Quantity _qty, Quantity _display, OrderId* result_id_ptr, UserId user_id = 1)
+    {
+        iceberg_order_impl(_tid, _side, _price, _qty, _display, user_id, result_id_ptr, nullptr);
+    }
+
+private:
+    void iceberg_order_impl(TickerId _tid, OrderSide _side, Price _price, Quantity _qty, Quantity _display, UserId user_id, OrderId* result_id_ptr, RequestRecord* record)
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end()) 
+            OrderEngineInfo* info = find_stock(_tid);
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
+            if (_price <= 0 || _qty <= 0)
+                throw std::runtime_error("Price/Quantity must be > 0");
+            if (_display < 0)
+                throw std::runtime_error("Display quantity must be >= 0");
+
+            // VALIDATE OWNERSHIP BEFORE SUBMITTING - against the total,
+            // hidden reserve included
+            if (_side == OrderSide::ASK)
+            {
+                if (!has_sufficient_shares(user_id, _tid, _qty))
+                {
+                    std::string err_msg = "User " + std::to_string(user_id) +
+                                         " does not have sufficient shares to sell " + std::to_string(_qty);
+                    throw std::runtime_error(err_msg);
+                }
+            }
 
-            auto& engine_info = it->second;
-            auto& arena = worker_arenas_[engine_info.worker_id_];
-            OrderEngine* engine_ptr = &it->second.engine_;
-
-            auto args_idx = arena.emplace(OrderJobArgs{
-                engine_ptr, _side, OrderType::LIMIT,
-                _price, _qty, order_id, 0, result_id_ptr, nullptr
-            });
-            
-            // Check if arena is full
-            if (args_idx == static_cast<Arena<OrderJobArgs>::Index>(-1))
-                throw std::runtime_error("Arena overflow - increase batch_size or arena capacity");
-            
-            auto arena_ptr = &arena;
-            
-            Job job(
-                [arena_ptr, args_idx]() {
-                    auto* params = &(*arena_ptr)[args_idx];
-                    *(params->result_id) = params->engine->edit_order(params->order_id, params->side, params->price, params->qty);
-                },
-                [arena_ptr, args_idx]() {
-                    arena_ptr->free(args_idx);
-                },
-                engine_info.engine_id_
-            );
-            
-            scheduler_.submit_job(std::move(job));
-            engine_info.batch_counter_ += 1;
-
-            // Auto-execute batch if batch_size is set and reached            
-            if (engine_info.batch_counter_ >= batch_size_)
+            auto& engine_info = *info;
+
+            // Build the job payload inline - nothing allocated per order
+            OrderJobArgs args{
+                &engine_info.engine_, _side, OrderType::ICEBERG,
+                _price, _qty, 0, result_id_ptr, nullptr,
+                owner_set(user_id, _tid), record,
+                user_balance(user_id, _tid), &engine_info.order_balance_,
+                _display
+            };
+
+            submit_or_run(Job(JobOp::PlaceLimit, args, engine_info.engine_id_), engine_info);
+            engine_info.rebalance_load_.fetch_add(1, std::memory_order_relaxed);
+
+            // Increment per-engine batch counter and auto-execute batch if
+            // needed. fetch_add keeps concurrent submitters race-free, and
+            // exactly one of them - the one whose add crosses the threshold -
+            // runs the batch
+            if (engine_info.batch_counter_.fetch_add(1, std::memory_order_acq_rel) + 1 == batch_size_)
             {
-                execute_batch(engine_info.worker_id_);
-                engine_info.batch_counter_ = 0;
+                execute_batch(engine_info.worker());
+                engine_info.batch_counter_.store(0, std::memory_order_relaxed);
             }
         }
         catch(const std::exception& e)
         {
             if (verbose_)
-                std::cerr << "Edit Order Error: " << e.what() << '\n';
+                std::cerr << "Place Order Error: " << e.what() << '\n';
             if (result_id_ptr) *result_id_ptr = static_cast<OrderId>(-1);
+            fail_request(record);
         }
     }
 
-    const OrderInfo* get_order(const std::string& _ticker, OrderId order_id) const
+public:
+    void iceberg_order(const std::string& _ticker, OrderSide _side, Price _price, Quantity _qty, Quantity _display, OrderId* result_id_ptr, UserId user_id = 1)
     {
-        try
-        {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end()) 
-                throw std::runtime_error("Stock Does Not Exist");
-
-            const auto& order = it->second.engine_.get_order(order_id);
-            // If no Order then error
-            if (!order)
-                throw std::runtime_error("Failed to Get Order");
-            return order;
-        }
-        catch(const std::exception& e)
-        {
-            if (verbose_)
-                std::cerr << "Get Order Error: " << e.what() << '\n';
-            return nullptr;
-        }
+        iceberg_order(get_ticker_id(_ticker), _side, _price, _qty, _display, result_id_ptr, user_id);
     }
 
+    void cancel_order(TickerId _tid, OrderId order_id, bool* result_ptr, UserId user_id = 1)
+    {
+        cancel_order_impl(_tid, order_id, user_id, result_ptr, nullptr);
+    }
 
-    Price get_market_price(const std::string& _ticker) const
+private:
+    void cancel_order_impl(TickerId _tid, OrderId order_id, UserId user_id, bool* result_ptr, RequestRecord* record)
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end()) 
+            OrderEngineInfo* info = find_stock(_tid);
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
 
-            return it->second.engine_.get_market_price();
+            auto& engine_info = *info;
+
+            // Build the job payload inline - nothing allocated per order
+            OrderJobArgs args{
+                &engine_info.engine_, OrderSide::BID, OrderType::LIMIT,
+                0, 0, order_id, nullptr, result_ptr,
+                owner_set(user_id, _tid), record,
+                nullptr, &engine_info.order_balance_
+            };
+
+            submit_or_run(Job(JobOp::Cancel, args, engine_info.engine_id_), engine_info);
+            engine_info.rebalance_load_.fetch_add(1, std::memory_order_relaxed);
+
+            // Increment per-engine batch counter and auto-execute batch if
+            // needed. fetch_add keeps concurrent submitters race-free, and
+            // exactly one of them - the one whose add crosses the threshold -
+            // runs the batch
+            if (engine_info.batch_counter_.fetch_add(1, std::memory_order_acq_rel) + 1 == batch_size_)
+            {
+                execute_batch(engine_info.worker());
+                engine_info.batch_counter_.store(0, std::memory_order_relaxed);
+            }
         }
         catch(const std::exception& e)
         {
             if (verbose_)
-                std::cerr << "Get Market Price Error: " << e.what() << '\n';
-            return -1;
+                std::cerr << "Cancel Order Error: " << e.what() << '\n';
+            if (result_ptr) *result_ptr = false;
+            fail_request(record);
         }
     }
 
-    Price get_best_bid(const std::string& _ticker) const
+public:
+    void cancel_order(const std::string& _ticker, OrderId order_id, bool* result_ptr, UserId user_id = 1)
     {
-        try
-        {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end()) 
-                throw std::runtime_error("Stock Does Not Exist");
+        cancel_order(get_ticker_id(_ticker), order_id, result_ptr, user_id);
+    }
 
-            auto best_bid = it->second.engine_.get_best_bid();
-            // If no best bid then error
-            if (best_bid == -1)
-                throw std::runtime_error("Bid Side is Empty");
-            return best_bid;
-        }
-        catch(const std::exception& e)
-        {
-            if (verbose_)
-                std::cerr << "Get Best Bid Error: " << e.what() << '\n';
-            return -1;
-        }
+    void edit_order(TickerId _tid, OrderId order_id, OrderSide _side, Price _price, Quantity _qty, OrderId* result_id_ptr)
+    {
+        edit_order_impl(_tid, order_id, _side, _price, _qty, result_id_ptr, nullptr);
     }
 
-    Price get_best_ask(const std::string& _ticker) const
+private:
+    void edit_order_impl(TickerId _tid, OrderId order_id, OrderSide _side, Price _price, Quantity _qty, OrderId* result_id_ptr, RequestRecord* record)
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end()) 
+            OrderEngineInfo* info = find_stock(_tid);
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
 
-            auto best_ask = it->second.engine_.get_best_ask();
-            // If no best ask then error
-            if (best_ask == -1)
-                throw std::runtime_error("Ask Side is Empty");
-            return best_ask;
+            auto& engine_info = *info;
+
+            // Build the job payload inline - nothing allocated per order
+            OrderJobArgs args{
+                &engine_info.engine_, _side, OrderType::LIMIT,
+                _price, _qty, order_id, result_id_ptr, nullptr,
+                nullptr, record,
+                nullptr, &engine_info.order_balance_
+            };
+
+            submit_or_run(Job(JobOp::Edit, args, engine_info.engine_id_), engine_info);
+            engine_info.rebalance_load_.fetch_add(1, std::memory_order_relaxed);
+
+            // Auto-execute batch if batch_size is set and reached; the
+            // fetch_add lets exactly one concurrent submitter claim the crossing
+            if (engine_info.batch_counter_.fetch_add(1, std::memory_order_acq_rel) + 1 == batch_size_)
+            {
+                execute_batch(engine_info.worker());
+                engine_info.batch_counter_.store(0, std::memory_order_relaxed);
+            }
         }
         catch(const std::exception& e)
         {
             if (verbose_)
-                std::cerr << "Get Best Ask Error: " << e.what() << '\n';
-            return -1;
+                std::cerr << "Edit Order Error: " << e.what() << '\n';
+            if (result_id_ptr) *result_id_ptr = static_cast<OrderId>(-1);
+            fail_request(record);
         }
     }
 
-    std::unordered_set<OrderId> get_orders_by_status(const std::string& _ticker, OrderStatus status) const
+public:
+    void edit_order(const std::string& _ticker, OrderId order_id, OrderSide _side, Price _price, Quantity _qty, OrderId* result_id_ptr)
+    {
+        edit_order(get_ticker_id(_ticker), order_id, _side, _price, _qty, result_id_ptr);
+    }
+
+    // True batch submission: validate and group the requests by ticker
+    // once, then push each group into its worker's queue as ONE
+    // multi-order job that loops place_order inside the worker. Skips
+    // the per-call lookup/validation/Job overhead of limit_order, and
+    // since a group runs back to back on the owning worker, its arena
+    // slots (and ids) come out contiguous. Returns orders accepted;
+    // rejected requests get NULL_ORDER written to their result slot.
+    std::size_t submit_orders(const OrderRequest* requests, std::size_t count)
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end()) 
-                throw std::runtime_error("Stock Does Not Exist");
-            return it->second.engine_.get_orders_by_status(status);
+            // Pass 1: validate each request exactly once and record the
+            // decision. Share balances are live atomics the workers mutate,
+            // so re-checking them in pass 2 could disagree with the group
+            // sizes computed here - overflowing an entry array or dropping
+            // a rejected request's NULL_ORDER write.
+            std::vector<bool> accept(count);
+            std::unordered_map<TickerId, std::size_t> group_sizes;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const OrderRequest& request = requests[i];
+                const bool ok = find_stock(request.tid) != nullptr
+                    && request.qty > 0
+                    && (request.type == OrderType::MARKET || request.price > 0)
+                    && (request.side != OrderSide::ASK
+                        || has_sufficient_shares(request.user, request.tid, request.qty));
+                accept[i] = ok;
+                if (ok)
+                    ++group_sizes[request.tid];
+                else if (request.result_id)
+                    *request.result_id = NULL_ORDER;
+            }
+
+            // Pass 2: fill one entry array per ticker (the worker frees it),
+            // reusing the pass-1 decisions
+            std::unordered_map<TickerId, BatchOrderJobArgs> groups;
+            groups.reserve(group_sizes.size());
+            std::size_t accepted = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (!accept[i])
+                    continue;
+                const OrderRequest& request = requests[i];
+
+                auto& group = groups[request.tid];
+                if (!group.entries)
+                {
+                    OrderEngineInfo& engine_info = *find_stock(request.tid);
+                    group.engine = &engine_info.engine_;
+                    group.entries = new BatchOrderEntry[group_sizes[request.tid]];
+                    group.count = 0;
+                    group.balance_registry = &engine_info.order_balance_;
+                }
+                group.entries[group.count++] = BatchOrderEntry{
+                    request.side, request.type, request.price, request.qty,
+                    request.result_id,
+                    owner_set(request.user, request.tid),
+                    user_balance(request.user, request.tid)};
+                ++accepted;
+            }
+
+            // Pass 3: one job per group into the owning worker's queue
+            for (auto& [tid, group] : groups)
+            {
+                OrderEngineInfo* info = find_stock(tid);
+                if (!info)
+                {
+                    delete[] group.entries;
+                    continue;
+                }
+                OrderEngineInfo& engine_info = *info;
+                submit_or_run(Job(JobOp::PlaceBatch, group, engine_info.engine_id_), engine_info);
+                engine_info.rebalance_load_.fetch_add(group.count, std::memory_order_relaxed);
+
+                // A group adds several jobs at once, so claim the threshold
+                // crossing from the pre-add count: only the add that straddles
+                // batch_size_ runs the batch
+                const std::size_t before = engine_info.batch_counter_.fetch_add(group.count, std::memory_order_acq_rel);
+                if (before < batch_size_ && before + group.count >= batch_size_)
+                {
+                    execute_batch(engine_info.worker());
+                    engine_info.batch_counter_.store(0, std::memory_order_relaxed);
+                }
+            }
+
+            return accepted;
         }
         catch(const std::exception& e)
         {
             if (verbose_)
-                std::cerr << "Get Orders By Status Error: " << e.what() << '\n';
-            static const std::unordered_set<OrderId> empty_orders;
-            return empty_orders;
+                std::cerr << "Submit Orders Error: " << e.what() << '\n';
+            return 0;
+        }
+    }
+
+    std::size_t submit_orders(const std::vector<OrderRequest>& requests)
+    {
+        return submit_orders(requests.data(), requests.size());
+    }
+
+    // Future-style order entry: results come back through a RequestHandle
+    // instead of a caller-owned pointer that must outlive the batch
+
+    RequestHandle<OrderId> submit_limit_order(TickerId _tid, OrderSide _side, Price _price, Quantity _qty, UserId user_id = 1)
+    {
+        RequestRecord* record = allocate_request(ResultKind::OrderId);
+        if (!record)
+            return RequestHandle<OrderId>();
+        limit_order_impl(_tid, _side, _price, _qty, user_id, nullptr, record);
+        return RequestHandle<OrderId>(record);
+    }
+
+    RequestHandle<OrderId> submit_limit_order(const std::string& _ticker, OrderSide _side, Price _price, Quantity _qty, UserId user_id = 1)
+    {
+        return submit_limit_order(get_ticker_id(_ticker), _side, _price, _qty, user_id);
+    }
+
+    RequestHandle<OrderId> submit_market_order(TickerId _tid, OrderSide _side, Quantity _qty, UserId user_id = 1)
+    {
+        RequestRecord* record = allocate_request(ResultKind::OrderId);
+        if (!record)
+            return RequestHandle<OrderId>();
+        market_order_impl(_tid, _side, _qty, user_id, nullptr, record);
+        return RequestHandle<OrderId>(record);
+    }
+
+    RequestHandle<OrderId> submit_market_order(const std::string& _ticker, OrderSide _side, Quantity _qty, UserId user_id = 1)
+    {
+        return submit_market_order(get_ticker_id(_ticker), _side, _qty, user_id);
+    }
+
+    RequestHandle<bool> submit_cancel_order(TickerId _tid, OrderId order_id, UserId user_id = 1)
+    {
+        RequestRecord* record = allocate_request(ResultKind::Bool);
+        if (!record)
+            return RequestHandle<bool>();
+        cancel_order_impl(_tid, order_id, user_id, nullptr, record);
+        return RequestHandle<bool>(record);
+    }
+
+    RequestHandle<bool> submit_cancel_order(const std::string& _ticker, OrderId order_id, UserId user_id = 1)
+    {
+        return submit_cancel_order(get_ticker_id(_ticker), order_id, user_id);
+    }
+
+    RequestHandle<OrderId> submit_edit_order(TickerId _tid, OrderId order_id, OrderSide _side, Price _price, Quantity _qty)
+    {
+        RequestRecord* record = allocate_request(ResultKind::OrderId);
+        if (!record)
+            return RequestHandle<OrderId>();
+        edit_order_impl(_tid, order_id, _side, _price, _qty, nullptr, record);
+        return RequestHandle<OrderId>(record);
+    }
+
+    RequestHandle<OrderId> submit_edit_order(const std::string& _ticker, OrderId order_id, OrderSide _side, Price _price, Quantity _qty)
+    {
+        return submit_edit_order(get_ticker_id(_ticker), order_id, _side, _price, _qty);
+    }
+
+    const OrderInfo* get_order(const std::string& _ticker, OrderId order_id) const
+    {
+        try
+        {
+            const OrderEngineInfo* info = find_stock(get_ticker_id(_ticker));
+            if (!info)
+                throw std::runtime_error("Stock Does Not Exist");
+
+            const auto& order = info->engine_.get_order(order_id);
+            // If no Order then error
+            if (!order)
+                throw std::runtime_error("Failed to Get Order");
+            return order;
+        }
+        catch(const std::exception& e)
+        {
+            if (verbose_)
+                std::cerr << "Get Order Error: " << e.what() << '\n';
+            return nullptr;
+        }
+    }
+
+
+    // GET: Lock-free top-of-book snapshot for a ticker (zeroed BookTop
+    // for unknown ids) - one seqlock read instead of per-field calls
+    BookTop get_top_of_book(TickerId _tid) const noexcept
+    {
+        const OrderEngineInfo* info = find_stock(_tid);
+        return info ? info->engine_.get_top_of_book() : BookTop{};
+    }
+
+    BookTop get_top_of_book(const std::string& _ticker) const noexcept
+    {
+        return get_top_of_book(get_ticker_id(_ticker));
+    }
+
+    Price get_market_price(const std::string& _ticker) const
+    {
+        try
+        {
+            const OrderEngineInfo* info = find_stock(get_ticker_id(_ticker));
+            if (!info)
+                throw std::runtime_error("Stock Does Not Exist");
+
+            return info->engine_.get_market_price();
+        }
+        catch(const std::exception& e)
+        {
+            if (verbose_)
+                std::cerr << "Get Market Price Error: " << e.what() << '\n';
+            return -1;
+        }
+    }
+
+    Price get_best_bid(const std::string& _ticker) const
+    {
+        try
+        {
+            const OrderEngineInfo* info = find_stock(get_ticker_id(_ticker));
+            if (!info)
+                throw std::runtime_error("Stock Does Not Exist");
+
+            auto best_bid = info->engine_.get_best_bid();
+            // If no best bid then error
+            if (best_bid == -1)
+                throw std::runtime_error("Bid Side is Empty");
+            return best_bid;
+        }
+        catch(const std::exception& e)
+        {
+            if (verbose_)
+                std::cerr << "Get Best Bid Error: " << e.what() << '\n';
+            return -1;
+        }
+    }
+
+    Price get_best_ask(const std::string& _ticker) const
+    {
+        try
+        {
+            const OrderEngineInfo* info = find_stock(get_ticker_id(_ticker));
+            if (!info)
+                throw std::runtime_error("Stock Does Not Exist");
+
+            auto best_ask = info->engine_.get_best_ask();
+            // If no best ask then error
+            if (best_ask == -1)
+                throw std::runtime_error("Ask Side is Empty");
+            return best_ask;
+        }
+        catch(const std::exception& e)
+        {
+            if (verbose_)
+                std::cerr << "Get Best Ask Error: " << e.what() << '\n';
+            return -1;
+        }
+    }
+
+    std::unordered_set<OrderId> get_orders_by_status(const std::string& _ticker, OrderStatus status) const
+    {
+        try
+        {
+            const OrderEngineInfo* info = find_stock(get_ticker_id(_ticker));
+            if (!info)
+                throw std::runtime_error("Stock Does Not Exist");
+            return info->engine_.get_orders_by_status(status);
+        }
+        catch(const std::exception& e)
+        {
+            if (verbose_)
+                std::cerr << "Get Orders By Status Error: " << e.what() << '\n';
+            static const std::unordered_set<OrderId> empty_orders;
+            return empty_orders;
         }
     }
 
@@ -598,10 +1070,10 @@ public:
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end()) 
+            const OrderEngineInfo* info = find_stock(get_ticker_id(_ticker));
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
-            return it->second.engine_.get_market_depth(_side, depth);
+            return info->engine_.get_market_depth(_side, depth);
         }
         catch(const std::exception& e)
         {
@@ -616,20 +1088,20 @@ public:
     {
         std::vector<std::string> tickers;
         // Iterate Through All Stocks in Exchange
-        for (const auto& stock: stock_exchange_)
+        for (const auto& stock: ticker_ids_)
             tickers.push_back(stock.first);
         return tickers;
     }
-    
-    const OrderEngine* get_engine(const std::string& _ticker)
+
+    const Engine* get_engine(const std::string& _ticker) const
     {
         try
         {
              // If ticker is not in Exchange then error
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end())
+            const OrderEngineInfo* info = find_stock(get_ticker_id(_ticker));
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
-            return &it->second.engine_;
+            return &info->engine_;
         }
         catch(const std::exception& e)
         {
@@ -644,10 +1116,10 @@ public:
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end())
+            OrderEngineInfo* info = find_stock(get_ticker_id(_ticker));
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
-            it->second.engine_.set_auto_match(auto_match);
+            info->engine_.set_auto_match(auto_match);
             return true;
         }
         catch(const std::exception& e)
@@ -663,10 +1135,10 @@ public:
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end())
+            const OrderEngineInfo* info = find_stock(get_ticker_id(_ticker));
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
-            return it->second.engine_.get_auto_match();
+            return info->engine_.get_auto_match();
         }
         catch(const std::exception& e)
         {
@@ -675,7 +1147,7 @@ public:
             return false;
         }
     }
-        
+
     // Execute all submitted jobs in the batch
     void execute_batch() noexcept
     {
@@ -688,14 +1160,34 @@ public:
             scheduler_.process_jobs_async();  // Non-blocking: just signals workers
         }
         // Centralized reset: clear per-engine batch counters for all engines
-        for (auto& kv : stock_exchange_)
-            kv.second.batch_counter_ = 0;
+        for (auto& info : stock_exchange_)
+            if (info)
+                info->batch_counter_.store(0, std::memory_order_relaxed);
+
+        // Recycle request records whose handles have been dropped
+        recycle_requests();
+
+        // Wake the strategy dispatch thread: one delivery per batch
+        if (dispatch_running_.load(std::memory_order_relaxed))
+            dispatch_epoch_.fetch_add(1, std::memory_order_release);
+
+        // Periodically rebalance engine ownership across workers
+        if (rebalance_interval_ > 0 && ++batches_since_rebalance_ >= rebalance_interval_)
+        {
+            batches_since_rebalance_ = 0;
+            rebalance_workers();
+        }
     }
 
     // Execute all submitted jobs in the batch
     void execute_batch(WorkerId worker_id) noexcept
     {
-        if (blocking_mode_)
+        if (inline_mode_)
+        {
+            // Jobs already ran on submission; only the per-batch
+            // bookkeeping below applies
+        }
+        else if (blocking_mode_)
         {
             scheduler_.process_jobs_on(worker_id);  // Blocking: waits for completion
         }
@@ -704,26 +1196,27 @@ public:
             scheduler_.process_jobs_on_async(worker_id);  // Non-blocking: just signals workers
         }
         // Centralized reset: clear per-engine batch counters for engines on this worker
-        for (auto& kv : stock_exchange_)
-            if (kv.second.worker_id_ == worker_id)
-                kv.second.batch_counter_ = 0;
+        for (auto& info : stock_exchange_)
+            if (info && info->worker() == worker_id)
+                info->batch_counter_.store(0, std::memory_order_relaxed);
+
+        // Wake the strategy dispatch thread: one delivery per batch
+        if (dispatch_running_.load(std::memory_order_relaxed))
+            dispatch_epoch_.fetch_add(1, std::memory_order_release);
     }
-    
+
     // Check if all jobs are completed (non-blocking check)
     bool all_jobs_completed() const noexcept { return scheduler_.is_complete(); }
-    
+
     // Check if a specific stock's jobs are completed (by ticker)
     bool is_engine_completed(const std::string& _ticker) const
     {
         try
         {
-            auto it = stock_exchange_.find(_ticker);
-            if (it == stock_exchange_.end())
+            const OrderEngineInfo* info = find_stock(get_ticker_id(_ticker));
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
-
-            std::size_t engine_id = it->second.engine_id_;
-            std::size_t worker_id = engine_id % num_workers_;
-            return scheduler_.is_worker_complete(worker_id);
+            return inline_mode_ || scheduler_.is_worker_complete(info->worker());
         }
         catch(const std::exception& e)
         {
@@ -732,28 +1225,35 @@ public:
             return false;
         }
     }
-    
+
     // Set blocking mode (true = wait for completion, false = async)
     void set_blocking_mode(bool blocking) noexcept
     {
         blocking_mode_ = blocking;
     }
-    
+
     // Get user's order IDs for a specific ticker
     std::vector<OrderId> get_positions(UserId user_id, const std::string& ticker) const
     {
         try
         {
-            auto user_it = user_orders_.find(user_id);
-            if (user_it == user_orders_.end())
-                throw std::runtime_error("User Does Not Exist");
-            
-            auto ticker_it = user_it->second.find(ticker);
-            if (ticker_it == user_it->second.end())
-                throw std::runtime_error("Stock Does Not Exist");
-            
-            // Return all order IDs for this user and ticker
-            return std::vector<OrderId>(ticker_it->second.begin(), ticker_it->second.end());
+            if constexpr (OwnershipPolicy::kEnabled)
+            {
+                auto user_it = ownership_.orders_.find(user_id);
+                if (user_it == ownership_.orders_.end())
+                    throw std::runtime_error("User Does Not Exist");
+
+                TickerId tid = get_ticker_id(ticker);
+                auto ticker_it = user_it->second.find(tid);
+                if (tid == INVALID_TICKER || ticker_it == user_it->second.end())
+                    throw std::runtime_error("Stock Does Not Exist");
+
+                // Return all order IDs for this user and ticker
+                const auto& orders = ticker_it->second;
+                return std::vector<OrderId>(orders.begin(), orders.end());
+            }
+            else
+                throw std::runtime_error("Ownership Tracking Is Compiled Out");
         }
         catch(const std::exception& e)
         {
@@ -761,87 +1261,844 @@ public:
             return {};
         }
     }
-    
-    // Check if user has sufficient shares to sell
+
+    // Check if user has sufficient shares to sell. O(1): a single compare
+    // against the incrementally-maintained open-ASK balance for the
+    // (user, ticker) pair - no order scan, however long the history.
+    bool has_sufficient_shares(UserId user_id, TickerId _tid, Quantity qty) const
+    {
+        auto user_it = share_balances_.find(user_id);
+        if (user_it == share_balances_.end())
+            return false; // User does not exist
+        if (_tid >= user_it->second.size() || !user_it->second[_tid])
+            return false; // User holds nothing on this ticker
+        return user_it->second[_tid]->load(std::memory_order_relaxed) >= qty;
+    }
+
     bool has_sufficient_shares(UserId user_id, const std::string& ticker, Quantity qty) const
+    {
+        return has_sufficient_shares(user_id, get_ticker_id(ticker), qty);
+    }
+
+    // Get blocking mode
+    bool get_blocking_mode() const noexcept { return blocking_mode_; }
+
+    // True when the runtime was built with num_threads == 0 and order
+    // entry runs inline on the caller's thread
+    bool is_inline() const noexcept { return inline_mode_; }
+
+    // Set batch size for auto-execution (0 = manual batching only)
+    void set_batch_size(std::size_t batch_size) noexcept
+    {
+        batch_size_ = batch_size;
+        // Reset per-engine batch counters
+        for (auto& info : stock_exchange_)
+            if (info)
+                info->batch_counter_.store(0, std::memory_order_relaxed);
+    }
+
+    // Get current batch size
+    std::size_t get_batch_size() const noexcept { return batch_size_; }
+
+    // GET: Worker that currently owns a ticker's engine (0 on unknown ids)
+    WorkerId get_worker(TickerId _tid) const noexcept
+    {
+        const OrderEngineInfo* info = find_stock(_tid);
+        return info ? info->worker() : 0;
+    }
+
+    // GET: Whether a worker's incoming job queue is at capacity
+    // (replay and other feeders use this as a backpressure signal)
+    bool is_worker_full(WorkerId worker_id) const noexcept
+    {
+        return !inline_mode_ && scheduler_.is_worker_full(worker_id) != 0;
+    }
+
+    // Start journaling engine events to a binary file. Engines registered
+    // from here on get a ring; already-registered engines are wired up too.
+    bool enable_journal(const std::string& path, std::size_t ring_capacity = 1 << 16)
+    {
+        try
+        {
+            journal_ = std::make_unique<EventJournal>(path, ring_capacity);
+            for (TickerId tid = 0; tid < stock_exchange_.size(); ++tid)
+                if (stock_exchange_[tid])
+                    stock_exchange_[tid]->engine_.attach_journal(journal_->create_ring(), tid);
+            return true;
+        }
+        catch(const std::exception& e)
+        {
+            if (verbose_)
+                std::cerr << "Enable Journal Error: " << e.what() << '\n';
+            return false;
+        }
+    }
+
+    // Flush and finalize the journal (engines stop recording)
+    void disable_journal()
+    {
+        if (!journal_)
+            return;
+        scheduler_.process_jobs(); // Drain in-flight jobs so their events land
+        for (auto& info : stock_exchange_)
+            if (info)
+                info->engine_.attach_journal(nullptr, 0);
+        journal_.reset(); // Destructor drains the rings and trims the file
+    }
+
+    const EventJournal* get_journal() const noexcept { return journal_.get(); }
+
+    // Start aggregating executed trades into OHLCV candles at the given
+    // interval. Engines registered from here on get a trade ring; already-
+    // registered engines are wired up too.
+    bool enable_candles(std::chrono::nanoseconds interval,
+                        std::size_t ring_capacity = 1 << 16,
+                        std::size_t history = 1 << 10)
+    {
+        try
+        {
+            candles_ = std::make_unique<CandleEngine>(interval, ring_capacity, history);
+            candle_feeds_.assign(stock_exchange_.size(), INVALID_FEED);
+            for (TickerId tid = 0; tid < stock_exchange_.size(); ++tid)
+                if (stock_exchange_[tid])
+                    wire_candles(tid);
+            return true;
+        }
+        catch(const std::exception& e)
+        {
+            if (verbose_)
+                std::cerr << "Candle Enable Error: " << e.what() << '\n';
+            return false;
+        }
+    }
+
+    // Stop aggregating (engines stop emitting trade ticks)
+    void disable_candles()
+    {
+        if (!candles_)
+            return;
+        scheduler_.process_jobs(); // Drain in-flight jobs so their trades land
+        for (auto& info : stock_exchange_)
+            if (info)
+                info->engine_.attach_trade_ring(nullptr);
+        candles_.reset(); // Destructor sweeps the rings one last time
+        candle_feeds_.clear();
+    }
+
+    // GET: A ticker's candle series - lock-free reads from any thread.
+    // Nullptr when candles are disabled or the ticker is unknown.
+    const CandleSeries* get_candles(TickerId _tid) const noexcept
+    {
+        if (!candles_ || _tid >= candle_feeds_.size() || candle_feeds_[_tid] == INVALID_FEED)
+            return nullptr;
+        return candles_->feed_series(candle_feeds_[_tid]);
+    }
+
+    const CandleSeries* get_candles(const std::string& _ticker) const noexcept
+    {
+        return get_candles(get_ticker_id(_ticker));
+    }
+
+    const CandleEngine* get_candle_engine() const noexcept { return candles_.get(); }
+
+    // Snapshot every registered engine into one memory-mapped binary
+    // image so a long replay can resume from mid-day state instead of
+    // re-feeding the whole order stream. Workers are quiesced first so
+    // the books are consistent.
+    bool snapshot_all(const std::string& path)
     {
         try
         {
-            auto user_it = user_orders_.find(user_id);
-            if (user_it == user_orders_.end())
-                throw std::runtime_error("User Does Not Exist");
-              
-            auto engine_it = stock_exchange_.find(ticker);
-            if (engine_it == stock_exchange_.end())
+            scheduler_.process_jobs(); // Drain every queue before reading the books
+
+            std::size_t total = sizeof(RuntimeSnapshotHeader);
+            std::uint32_t engine_count = 0;
+            for (const auto& info : stock_exchange_)
+                if (info)
+                {
+                    total += sizeof(std::uint32_t) + info->engine_.snapshot_size();
+                    ++engine_count;
+                }
+
+            // User state: (user, ticker, order-id set) ownership records
+            // and (user, ticker, quantity) share balance records
+            // An untracked runtime simply records zero ownership sets
+            std::uint64_t ownership_records = 0;
+            std::uint64_t owned_orders = 0;
+            if constexpr (OwnershipPolicy::kEnabled)
+                for (const auto& [user_id, user_tickers] : ownership_.orders_)
+                    for (const auto& [tid, orders] : user_tickers)
+                    {
+                        ++ownership_records;
+                        owned_orders += orders.size();
+                    }
+            std::uint64_t balance_records = 0;
+            for (const auto& [user_id, balances] : share_balances_)
+                for (const auto& balance : balances)
+                    if (balance)
+                        ++balance_records;
+            total += 2 * sizeof(std::uint64_t)
+                   + ownership_records * (2 * sizeof(std::uint32_t) + sizeof(std::uint64_t))
+                   + owned_orders * sizeof(OrderId)
+                   + balance_records * (2 * sizeof(std::uint32_t) + sizeof(Quantity));
+
+            int fd = ::open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+            if (fd < 0)
+                throw std::runtime_error("Snapshot Open Failed: " + path);
+            if (::ftruncate(fd, static_cast<off_t>(total)) != 0)
+            {
+                ::close(fd);
+                throw std::runtime_error("Snapshot Resize Failed: " + path);
+            }
+            void* map = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (map == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("Snapshot Map Failed: " + path);
+            }
+
+            unsigned char* dst = static_cast<unsigned char*>(map);
+            RuntimeSnapshotHeader header{RUNTIME_SNAPSHOT_MAGIC, RUNTIME_SNAPSHOT_VERSION, engine_count};
+            std::memcpy(dst, &header, sizeof(header));
+            std::size_t offset = sizeof(header);
+            for (TickerId tid = 0; tid < stock_exchange_.size(); ++tid)
+                if (stock_exchange_[tid])
+                {
+                    std::memcpy(dst + offset, &tid, sizeof(std::uint32_t));
+                    offset += sizeof(std::uint32_t);
+                    offset += stock_exchange_[tid]->engine_.save_snapshot(dst + offset);
+                }
+
+            auto put_u32 = [&](std::uint32_t value)
+            {
+                std::memcpy(dst + offset, &value, sizeof(value));
+                offset += sizeof(value);
+            };
+            auto put_u64 = [&](std::uint64_t value)
+            {
+                std::memcpy(dst + offset, &value, sizeof(value));
+                offset += sizeof(value);
+            };
+
+            put_u64(ownership_records);
+            if constexpr (OwnershipPolicy::kEnabled)
+                for (const auto& [user_id, user_tickers] : ownership_.orders_)
+                    for (const auto& [tid, orders] : user_tickers)
+                    {
+                        put_u32(user_id);
+                        put_u32(tid);
+                        put_u64(orders.size());
+                        for (OrderId id : orders)
+                            put_u32(id);
+                    }
+
+            put_u64(balance_records);
+            for (const auto& [user_id, balances] : share_balances_)
+                for (TickerId tid = 0; tid < balances.size(); ++tid)
+                    if (balances[tid])
+                    {
+                        put_u32(user_id);
+                        put_u32(tid);
+                        const Quantity qty = balances[tid]->load(std::memory_order_relaxed);
+                        std::memcpy(dst + offset, &qty, sizeof(qty));
+                        offset += sizeof(qty);
+                    }
+
+            ::msync(map, offset, MS_SYNC);
+            ::munmap(map, total);
+            ::close(fd);
+
+            if (verbose_)
+                std::cout << "[RUNTIME] Snapshot: " << engine_count << " engines, "
+                          << offset << " bytes -> " << path << std::endl;
+            return true;
+        }
+        catch(const std::exception& e)
+        {
+            if (verbose_)
+                std::cerr << "Snapshot Error: " << e.what() << '\n';
+            return false;
+        }
+    }
+
+    // Restore a snapshot_all() image: the current exchange is dropped,
+    // every engine in the image is re-registered under its saved ticker
+    // at near-memcpy speed, and user order ownership and share balances
+    // come back with it. Ticker ids are re-assigned densely, so an image
+    // saved after unregister_stock may map old ids to new ones.
+    bool restore_all(const std::string& path)
+    {
+        int fd = -1;
+        void* map = MAP_FAILED;
+        std::size_t size = 0;
+        try
+        {
+            reset();
+
+            fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                throw std::runtime_error("Snapshot Open Failed: " + path);
+            struct stat st{};
+            if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(RuntimeSnapshotHeader)))
+                throw std::runtime_error("Snapshot Invalid: " + path);
+            size = static_cast<std::size_t>(st.st_size);
+            map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED)
+                throw std::runtime_error("Snapshot Map Failed: " + path);
+            const unsigned char* src = static_cast<const unsigned char*>(map);
+
+            RuntimeSnapshotHeader header;
+            std::memcpy(&header, src, sizeof(header));
+            if (header.magic != RUNTIME_SNAPSHOT_MAGIC || header.version != RUNTIME_SNAPSHOT_VERSION)
+                throw std::runtime_error("Snapshot Corrupt: " + path);
+
+            std::size_t offset = sizeof(header);
+
+            // Saved ticker id -> restored ticker id (ids are re-packed densely)
+            std::unordered_map<TickerId, TickerId> tid_map;
+            for (std::uint32_t i = 0; i < header.engine_count; ++i)
+            {
+                // Peek the engine header for its identity and sizing
+                std::uint32_t saved_tid;
+                EngineSnapshotHeader engine_header;
+                if (size - offset < sizeof(saved_tid) + sizeof(engine_header))
+                    throw std::runtime_error("Snapshot Truncated: " + path);
+                std::memcpy(&saved_tid, src + offset, sizeof(saved_tid));
+                offset += sizeof(saved_tid);
+                std::memcpy(&engine_header, src + offset, sizeof(engine_header));
+                if (engine_header.magic != SNAPSHOT_MAGIC)
+                    throw std::runtime_error("Snapshot Corrupt: " + path);
+                std::string ticker(reinterpret_cast<const char*>(src + offset + sizeof(engine_header)),
+                                   engine_header.ticker_len);
+
+                EngineId engine_id = next_engine_id_++;
+                TickerId tid = static_cast<TickerId>(stock_exchange_.size());
+                stock_exchange_.push_back(std::make_unique<OrderEngineInfo>(
+                    ticker, engine_header.order_count + 1, verbose_, 0,  // IPO shares live in the image
+                    engine_id, engine_id % num_workers_, engine_header.tick_size));
+                ticker_ids_.emplace(ticker, tid);
+
+                if (journal_)
+                    stock_exchange_[tid]->engine_.attach_journal(journal_->create_ring(), tid);
+                if (candles_)
+                    wire_candles(tid);
+
+                std::size_t used = stock_exchange_[tid]->engine_.load_snapshot(src + offset, size - offset);
+                if (used == 0)
+                    throw std::runtime_error("Snapshot Corrupt: " + ticker);
+                offset += used;
+                tid_map.emplace(saved_tid, tid);
+            }
+
+            auto get_u32 = [&]() -> std::uint32_t
+            {
+                std::uint32_t value;
+                std::memcpy(&value, src + offset, sizeof(value));
+                offset += sizeof(value);
+                return value;
+            };
+            auto get_u64 = [&]() -> std::uint64_t
+            {
+                std::uint64_t value;
+                std::memcpy(&value, src + offset, sizeof(value));
+                offset += sizeof(value);
+                return value;
+            };
+            if (size - offset < sizeof(std::uint64_t))
+                throw std::runtime_error("Snapshot Truncated: " + path);
+
+            // Ownership sets; resting ASK orders are also re-registered
+            // against their owner's balance so later fills debit it. An
+            // untracked runtime still walks the records for the balance
+            // wiring - only the set inserts are compiled out.
+            const std::uint64_t ownership_records = get_u64();
+            for (std::uint64_t i = 0; i < ownership_records; ++i)
+            {
+                const UserId user_id = get_u32();
+                const TickerId tid = tid_map.at(get_u32());
+                const std::uint64_t order_count = get_u64();
+                auto& engine_info = *stock_exchange_[tid];
+                for (std::uint64_t j = 0; j < order_count; ++j)
+                {
+                    const OrderId id = get_u32();
+                    if constexpr (OwnershipPolicy::kEnabled)
+                        user_ticker_orders(user_id, tid).insert(id);
+                    const OrderInfo* order = engine_info.engine_.get_order(id);
+                    if (order && order->status_ == OrderStatus::OPEN && order->side_ == OrderSide::ASK)
+                    {
+                        if (engine_info.order_balance_.size() <= id)
+                            engine_info.order_balance_.resize(id + 1, nullptr);
+                        engine_info.order_balance_[id] = user_balance(user_id, tid);
+                    }
+                }
+            }
+
+            const std::uint64_t balance_records = get_u64();
+            for (std::uint64_t i = 0; i < balance_records; ++i)
+            {
+                const UserId user_id = get_u32();
+                const TickerId tid = tid_map.at(get_u32());
+                Quantity qty;
+                std::memcpy(&qty, src + offset, sizeof(qty));
+                offset += sizeof(qty);
+                user_balance(user_id, tid)->store(qty, std::memory_order_relaxed);
+            }
+
+            ::munmap(map, size);
+            ::close(fd);
+
+            if (verbose_)
+                std::cout << "[RUNTIME] Restored " << header.engine_count
+                          << " engines from " << path << std::endl;
+            return true;
+        }
+        catch(const std::exception& e)
+        {
+            if (map != MAP_FAILED)
+                ::munmap(map, size);
+            if (fd >= 0)
+                ::close(fd);
+            if (verbose_)
+                std::cerr << "Restore Error: " << e.what() << '\n';
+            return false;
+        }
+    }
+
+    // Rebalance engine ownership every N full batches (0 = static assignment)
+    void set_rebalance_interval(std::size_t interval) noexcept
+    {
+        rebalance_interval_ = interval;
+        batches_since_rebalance_ = 0;
+    }
+
+    std::size_t get_rebalance_interval() const noexcept { return rebalance_interval_; }
+
+    // Snapshot a ticker's statistics. Relaxed loads only: reading never
+    // stops the owning worker or dirties its cache lines with writes.
+    EngineStats get_stats(TickerId _tid) const
+    {
+        try
+        {
+            const OrderEngineInfo* info = find_stock(_tid);
+            if (!info)
+                throw std::runtime_error("Stock Does Not Exist");
+
+            const EngineCounters& counters = info->engine_.get_counters();
+            EngineStats stats;
+            stats.orders_placed = counters.orders_placed.load(std::memory_order_relaxed);
+            stats.orders_matched = counters.orders_matched.load(std::memory_order_relaxed);
+            stats.orders_cancelled = counters.orders_cancelled.load(std::memory_order_relaxed);
+            stats.orders_rejected = counters.orders_rejected.load(std::memory_order_relaxed);
+            stats.trades = counters.trades.load(std::memory_order_relaxed);
+            stats.match_iterations = counters.match_iterations.load(std::memory_order_relaxed);
+            stats.trade_volume = counters.trade_volume.load(std::memory_order_relaxed);
+            stats.open_orders = info->engine_.get_status_count(OrderStatus::OPEN);
+            stats.filled_orders = info->engine_.get_status_count(OrderStatus::FILLED);
+            stats.bid_levels = info->engine_.get_level_count(OrderSide::BID);
+            stats.ask_levels = info->engine_.get_level_count(OrderSide::ASK);
+            stats.worker = info->worker();
+            if (!inline_mode_)
+                stats.worker_stats = scheduler_.get_worker_stats(stats.worker);
+            return stats;
+        }
+        catch(const std::exception& e)
+        {
+            if (verbose_)
+                std::cerr << "Get Stats Error: " << e.what() << '\n';
+            return EngineStats{};
+        }
+    }
+
+    EngineStats get_stats(const std::string& _ticker) const
+    {
+        return get_stats(get_ticker_id(_ticker));
+    }
+
+    // Subscribe a strategy to a ticker's event stream. Fill/cancel/reject
+    // events produced inside the matching engine are queued on a per-engine
+    // ring and delivered on a dedicated dispatch thread in batches at batch
+    // boundaries - matching workers never run strategy code. Callbacks run
+    // on the dispatch thread; submitting orders from a callback is safe
+    // (the job queues take concurrent producers) but shares the
+    // coordinator's bookkeeping, so keep callback-side submission and
+    // coordinator-side submission off the same user/ticker.
+    bool register_strategy(TickerId _tid, TradingStrategy* strategy)
+    {
+        // Strategy callbacks hold plain OrderEngine/EngineRuntime pointers
+        // (virtuals cannot be templated), so only the default instantiation
+        // can host subscribers - specialized sweep runtimes have no console
+        // and no strategies anyway
+        static_assert(std::is_same_v<Engine, OrderEngine> && std::is_same_v<OwnershipPolicy, TrackedOwnership>,
+                      "strategy callbacks require the default EngineRuntime instantiation");
+        try
+        {
+            OrderEngineInfo* info = find_stock(_tid);
+            if (!info)
                 throw std::runtime_error("Stock Does Not Exist");
-                
-            auto ticker_it = user_it->second.find(ticker);
-            if (ticker_it == user_it->second.end())
-                throw std::runtime_error("User Does Not Own Stock");
-            
-                // Sum quantities from all OPEN ASK orders (shares available to sell)
-            Quantity total = 0;
-            const OrderEngine& engine = engine_it->second.engine_;
-            for (OrderId order_id : ticker_it->second)
+            if (!strategy)
+                throw std::runtime_error("Strategy Is Null");
+
+            std::lock_guard<std::mutex> lock(strategies_mutex_);
+
+            // First subscriber for this ticker wires the engine to a ring
+            auto& ring = strategy_rings_[_tid];
+            if (!ring)
             {
-                const OrderInfo* order = engine.get_order(order_id);
-                if (order && order->status_ == OrderStatus::OPEN && order->side_ == OrderSide::ASK)
-                    total += order->qty_;
+                ring = std::make_unique<EventRing>(STRATEGY_RING_CAPACITY);
+                info->engine_.attach_event_bus(ring.get(), _tid);
             }
-            
-            return total >= qty;
+            strategies_[_tid].push_back(strategy);
+            start_dispatch();
+
+            if (verbose_)
+                std::cout << "[RUNTIME] Registered strategy on " << info->engine_.get_ticker() << std::endl;
+            return true;
         }
         catch(const std::exception& e)
         {
-            std::cerr << "Has Sufficient Shares Error: " << e.what() << '\n';
+            if (verbose_)
+                std::cerr << "Register Strategy Error: " << e.what() << '\n';
             return false;
         }
-        
     }
 
-    // Get blocking mode
-    bool get_blocking_mode() const noexcept { return blocking_mode_; }
-    
-    // Set batch size for auto-execution (0 = manual batching only)
-    void set_batch_size(std::size_t batch_size) noexcept
+    bool register_strategy(const std::string& _ticker, TradingStrategy* strategy)
     {
-        batch_size_ = batch_size;
-        // Reset per-engine batch counters
-        for (auto& kv : stock_exchange_)
-            kv.second.batch_counter_ = 0;
+        return register_strategy(get_ticker_id(_ticker), strategy);
+    }
+
+    // Unsubscribe a strategy (the engine's ring stays attached; events it
+    // queues with no subscribers are discarded by the dispatch thread)
+    bool unregister_strategy(TickerId _tid, TradingStrategy* strategy)
+    {
+        std::lock_guard<std::mutex> lock(strategies_mutex_);
+        auto it = strategies_.find(_tid);
+        if (it == strategies_.end())
+            return false;
+        auto& subscribers = it->second;
+        auto pos = std::find(subscribers.begin(), subscribers.end(), strategy);
+        if (pos == subscribers.end())
+            return false;
+        subscribers.erase(pos);
+        return true;
+    }
+
+    bool unregister_strategy(const std::string& _ticker, TradingStrategy* strategy)
+    {
+        return unregister_strategy(get_ticker_id(_ticker), strategy);
     }
-    
-    // Get current batch size
-    std::size_t get_batch_size() const noexcept { return batch_size_; }
 
 private:
-    EngineMap stock_exchange_;  // Maps ticker -> OrderEngineInfo (contains engine, ipo_shares, engine_id)
+    std::vector<std::unique_ptr<OrderEngineInfo>> stock_exchange_;  // TickerId -> OrderEngineInfo (stable slots)
+    std::unordered_map<std::string, TickerId> ticker_ids_;  // Ticker name -> interned id
     JobScheduler scheduler_;
-    std::vector<ArgsArena> worker_arenas_;  // One arena per worker thread
     std::size_t num_workers_;  // Number of worker threads
     std::size_t default_capacity_; // Default capacity for new OrderEngines
     std::size_t batch_size_;  // Auto-execute batch after this many jobs (0 = manual only)
     EngineId next_engine_id_;  // Counter for assigning engine IDs
+    std::size_t rebalance_interval_;  // Rebalance ownership every N full batches (0 = off)
+    std::size_t batches_since_rebalance_;  // Full batches since the last rebalance
     bool verbose_; // Verbose Mode
+    bool inline_mode_;  // True = no workers; jobs run on the caller's thread
     bool blocking_mode_;  // True = wait for completion, False = async
-    
-    // Order ownership tracking: user_orders_[user_id][ticker] = {order_ids}
-    UserOrderMap user_orders_;
-    
-    // Private constructor for singleton
-    EngineRuntime(std::size_t num_threads, std::size_t default_capacity, std::size_t batch_size, bool _verbose, bool blocking)
-    : num_workers_(num_threads),
-      default_capacity_(default_capacity),
-      verbose_(_verbose),
-      batch_size_(batch_size > 0 ? batch_size : default_capacity),
-      scheduler_(num_threads, batch_size),
-      next_engine_id_(0),
-      blocking_mode_(blocking)
+
+    // Order ownership tracking state: ownership_.orders_[user_id][ticker_id]
+    // = {order_ids} when tracked; an empty struct when compiled out
+    OwnershipPolicy ownership_;
+
+    // Open-ASK share balances: share_balances_[user_id][ticker_id] is the
+    // quantity the user currently has resting on the ask side - a flat
+    // array per user keyed on the interned id (ids are dense and never
+    // reused). unique_ptr slots so counter addresses survive growth.
+    std::unordered_map<UserId, std::vector<std::unique_ptr<std::atomic<Quantity>>>> share_balances_;
+
+    // Future-style request records and their in-flight indices
+    RequestArena request_arena_;
+    std::vector<RequestArena::Index> pending_requests_;
+
+    // Binary event journal (optional; rings are owned by the journal)
+    std::unique_ptr<EventJournal> journal_;
+
+    // OHLCV candle aggregator (optional; rings and series are owned by
+    // the candle engine) and the ticker id -> feed slot mapping
+    static constexpr std::size_t INVALID_FEED = static_cast<std::size_t>(-1);
+    std::unique_ptr<CandleEngine> candles_;
+    std::vector<std::size_t> candle_feeds_;
+
+    // Helper: Give a registered engine a candle feed and attach its ring
+    void wire_candles(TickerId tid)
+    {
+        const std::size_t feed = candles_->create_feed();
+        if (candle_feeds_.size() <= tid)
+            candle_feeds_.resize(tid + 1, INVALID_FEED);
+        candle_feeds_[tid] = feed;
+        stock_exchange_[tid]->engine_.attach_trade_ring(candles_->feed_ring(feed));
+    }
+
+    // Strategy event bus: per-ticker subscriber lists, per-engine rings and
+    // a dedicated dispatch thread that drains them once per executed batch
+    static constexpr std::size_t STRATEGY_RING_CAPACITY = 1 << 16;
+    std::unordered_map<TickerId, std::vector<TradingStrategy*>> strategies_;
+    std::unordered_map<TickerId, std::unique_ptr<EventRing>> strategy_rings_;
+    mutable std::mutex strategies_mutex_;
+    std::thread dispatch_thread_;
+    std::atomic<bool> dispatch_running_{false};
+    std::atomic<std::uint64_t> dispatch_epoch_{0}; // Bumped once per executed batch
+
+    // Lazily start the dispatch thread when the first strategy registers
+    void start_dispatch()
+    {
+        if (dispatch_running_.exchange(true, std::memory_order_acq_rel))
+            return;
+        dispatch_thread_ = std::thread([this]() { dispatch_loop(); });
+    }
+
+    void stop_dispatch() noexcept
     {
-        // Arena of Args per worker
-        std::size_t arena_capacity_per_worker = batch_size_;
-        
-        for (std::size_t i = 0; i < num_threads; ++i)
-            worker_arenas_.emplace_back(arena_capacity_per_worker);
+        if (!dispatch_running_.exchange(false, std::memory_order_acq_rel))
+            return;
+        if (dispatch_thread_.joinable())
+            dispatch_thread_.join();
+    }
+
+    // Dispatch thread: wait for a batch boundary to bump the epoch, then
+    // deliver everything the engines queued since the last delivery
+    void dispatch_loop() noexcept
+    {
+        std::uint64_t delivered = 0;
+        while (dispatch_running_.load(std::memory_order_acquire))
+        {
+            if (dispatch_epoch_.load(std::memory_order_acquire) == delivered)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            delivered = dispatch_epoch_.load(std::memory_order_acquire);
+            deliver_events();
+        }
+        deliver_events(); // Final sweep so shutdown drops nothing
+    }
+
+    // Defined below trading_strategy.cpp - it invokes the full interface
+    void deliver_events() noexcept;
+
+    // Hand a job to its engine's worker - or, in inline mode, run the
+    // exact same dispatch on the caller's thread. Result-delivery
+    // semantics are identical either way; inline results are just ready
+    // before the call returns.
+    void submit_or_run(Job&& job, OrderEngineInfo& engine_info) noexcept
+    {
+        if (inline_mode_)
+            JobScheduler::run_inline(job);
+        else
+            scheduler_.submit_job(std::move(job), engine_info.worker());
+    }
+
+    // Look up an engine slot by interned id (nullptr if unknown or retired)
+    OrderEngineInfo* find_stock(TickerId tid) noexcept
+    {
+        return tid < stock_exchange_.size() ? stock_exchange_[tid].get() : nullptr;
+    }
+
+    const OrderEngineInfo* find_stock(TickerId tid) const noexcept
+    {
+        return tid < stock_exchange_.size() ? stock_exchange_[tid].get() : nullptr;
+    }
+
+    // Get (creating on demand) a user's order set for a ticker id.
+    // The returned reference stays valid across later insertions.
+    // Tracked runtimes only - callers policy-gate every use.
+    std::unordered_set<OrderId>& user_ticker_orders(UserId user_id, TickerId tid)
+    {
+        return ownership_.orders_[user_id][tid];
+    }
+
+    // Ownership set a job should maintain for this (user, ticker) -
+    // nullptr when tracking is compiled out, which the job opcodes
+    // already treat as "don't track"
+    std::unordered_set<OrderId>* owner_set(UserId user_id, TickerId tid)
+    {
+        if constexpr (OwnershipPolicy::kEnabled)
+            return &user_ticker_orders(user_id, tid);
+        else
+            return nullptr;
     }
+
+    // Get (creating on demand) a user's balance counter for a ticker id.
+    // The counter's address is stable: jobs carry it to the worker.
+    std::atomic<Quantity>* user_balance(UserId user_id, TickerId tid)
+    {
+        auto& balances = share_balances_[user_id];
+        if (balances.size() <= tid)
+            balances.resize(tid + 1);
+        if (!balances[tid])
+            balances[tid] = std::make_unique<std::atomic<Quantity>>(0.0);
+        return balances[tid].get();
+    }
+
+    // Grab a request record from the arena (record addresses are stable:
+    // the arena never reallocates). Recycles completed records when full.
+    RequestRecord* allocate_request(ResultKind kind)
+    {
+        auto idx = request_arena_.emplace(kind);
+        if (idx == static_cast<RequestArena::Index>(-1))
+        {
+            recycle_requests();
+            idx = request_arena_.emplace(kind);
+            if (idx == static_cast<RequestArena::Index>(-1))
+            {
+                if (verbose_)
+                    std::cerr << "Request Error: too many requests in flight" << '\n';
+                return nullptr;
+            }
+        }
+        pending_requests_.push_back(idx);
+        return &request_arena_[idx];
+    }
+
+    // Batched recycling: free every record whose result has been published
+    // and whose handle has been dropped. Runs at batch boundaries.
+    void recycle_requests() noexcept
+    {
+        for (std::size_t i = 0; i < pending_requests_.size();)
+        {
+            RequestRecord& record = request_arena_[pending_requests_[i]];
+            if (record.ready.load(std::memory_order_acquire) &&
+                record.released.load(std::memory_order_acquire))
+            {
+                request_arena_.free(pending_requests_[i]);
+                pending_requests_[i] = pending_requests_.back();
+                pending_requests_.pop_back();
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+
+    // Publish a failure so a handle's wait() never hangs on a rejected request
+    static void fail_request(RequestRecord* record) noexcept
+    {
+        if (!record) return;
+        record->result.order_id = static_cast<OrderId>(-1);
+        record->status = RequestStatus::Failed;
+        record->ready.store(true, std::memory_order_release);
+    }
+
+    // Load-aware reassignment of engines to workers. Volume is usually
+    // power-law distributed, so a static engine_id % num_workers split
+    // leaves most workers idle while one saturates. Sort engines by jobs
+    // submitted since the last rebalance and greedily hand each to the
+    // least-loaded worker. Coarse by design: migration only happens here,
+    // at a batch boundary, and the source worker is drained first so each
+    // engine stays single-threaded.
+    void rebalance_workers() noexcept
+    {
+        if (num_workers_ < 2)
+            return;
+
+        // Snapshot per-engine load since the last rebalance
+        std::vector<std::pair<std::size_t, OrderEngineInfo*>> loads;
+        loads.reserve(stock_exchange_.size());
+        for (auto& info : stock_exchange_)
+            if (info)
+                loads.emplace_back(info->rebalance_load_.exchange(0, std::memory_order_relaxed), info.get());
+
+        if (loads.size() < 2)
+            return;
+
+        // Heaviest engines first, then greedy longest-processing-time assignment
+        std::sort(loads.begin(), loads.end(),
+            [](const auto& a, const auto& b) { return a.first > b.first; });
+
+        std::vector<std::size_t> worker_load(num_workers_, 0);
+        for (auto& [load, info] : loads)
+        {
+            WorkerId target = 0;
+            for (WorkerId w = 1; w < num_workers_; ++w)
+                if (worker_load[w] < worker_load[target])
+                    target = w;
+            worker_load[target] += load;
+
+            WorkerId current = info->worker();
+            if (current != target)
+            {
+                // Drain the old worker so no queued job runs after the move
+                scheduler_.process_jobs_on(current);
+                info->worker_id_.store(target, std::memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+    ~BasicEngineRuntime() { stop_dispatch(); }
 };
+
+// Default runtime: ownership tracking on, default engines - the
+// historical EngineRuntime behavior. Strategy callbacks are typed on
+// this instantiation (TradingStrategy below holds plain pointers).
+using EngineRuntime = BasicEngineRuntime<>;
+
+// Headless sweep runtime: engines with matching fixed on and console
+// notifications compiled out, and no per-order ownership bookkeeping.
+// Same API; get_positions() reports tracking as compiled out.
+using HeadlessEngineRuntime = BasicEngineRuntime<UntrackedOwnership, HeadlessOrderEngine>;
+
+// The example strategies below call the full EngineRuntime interface, so
+// the include has to come after the class; deliver_events in turn invokes
+// the virtual strategy interface, so it is defined down here too.
+#include "trading_strategy.cpp"
+
+// Drain every strategy ring and deliver callbacks. Runs on the dispatch
+// thread only. Per-order events (fills, cancels, rejects) go out as they
+// pop; on_book_update fires once per ticker per delivery, not per event -
+// that is what amortizes the virtual-call cost across a batch.
+template <typename OwnershipPolicy, typename Engine>
+inline void BasicEngineRuntime<OwnershipPolicy, Engine>::deliver_events() noexcept
+{
+    std::lock_guard<std::mutex> lock(strategies_mutex_);
+    JournalEvent event;
+    for (auto& [tid, ring] : strategy_rings_)
+    {
+        const OrderEngineInfo* info = find_stock(tid);
+        auto strat_it = strategies_.find(tid);
+        if (!info || strat_it == strategies_.end() || strat_it->second.empty())
+        {
+            while (ring->try_pop(event)) {} // Nobody listening - discard
+            continue;
+        }
+
+        const std::string& ticker = info->engine_.get_ticker();
+        auto& subscribers = strat_it->second;
+        bool book_changed = false;
+
+        while (ring->try_pop(event))
+        {
+            book_changed = true;
+            switch (static_cast<EventKind>(event.kind))
+            {
+                case EventKind::Fill:
+                case EventKind::PartialFill:
+                    for (TradingStrategy* strategy : subscribers)
+                        strategy->on_fill(ticker, event.order_id, event.price, event.qty);
+                    break;
+                case EventKind::Cancel:
+                    for (TradingStrategy* strategy : subscribers)
+                        strategy->on_cancel(ticker, event.order_id);
+                    break;
+                case EventKind::Reject:
+                    for (TradingStrategy* strategy : subscribers)
+                        strategy->on_reject(ticker, event.order_id, "Order Rejected");
+                    break;
+                default:
+                    break; // Opens/modifies move the book but have no per-order callback
+            }
+        }
+
+        // One book-update callback per ticker per batch
+        if (book_changed)
+            for (TradingStrategy* strategy : subscribers)
+                strategy->on_book_update(ticker, &info->engine_, this);
+    }
+}
@@ -1,51 +1,280 @@
+#include "order_engine.cpp"
 #include "../tools/double_buffer.cpp"
 #include <thread>
 #include <atomic>
-#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <type_traits>
+#include <new>
+#include <pthread.h>
+#include <sched.h>
 
-struct Job
+enum class RequestStatus : std::uint8_t
 {
-    std::function<void()> execute;
+    Pending,    // Request has been created but not yet submitted
+    InProgress,     // Request is currently being processed by a worker
+    Completed,      // Request finished successfully and result is available
+    Failed,         // Request finished but encountered an error
+    Cancelled       // Request was cancelled before completion
+};
+
+// Different Request Types
+enum class ResultKind : std::uint8_t
+{
+    None,
+    OrderId,
+    Price,
+    Bool,
+};
+
+// Arena-allocated result slot a worker publishes into. ready is the
+// publication point (release on write, acquire on read); released marks
+// the consuming handle as dropped so the runtime can recycle the slot.
+struct RequestRecord
+{
+    std::atomic<bool> ready{false};     // Release-stored by the worker once the result is in
+    std::atomic<bool> released{false};  // Set when the owning handle is dropped
+    ResultKind kind = ResultKind::None;
+    RequestStatus status = RequestStatus::Pending;
+
+    union { // Union Types
+        OrderId   order_id;
+        Price     price;
+        bool      ok;
+    } result;
+
+    RequestRecord() noexcept { result.order_id = 0; }
+
+    explicit RequestRecord(ResultKind _kind) noexcept
+    : kind(_kind)
+    {
+        result.order_id = 0;
+    }
+
+    // Arena reuses slots by move-assignment; atomics need explicit handling
+    RequestRecord(RequestRecord&& other) noexcept
+    : ready(other.ready.load()), released(other.released.load()),
+      kind(other.kind), status(other.status), result(other.result)
+    {}
+
+    RequestRecord& operator=(RequestRecord&& other) noexcept
+    {
+        ready.store(other.ready.load());
+        released.store(other.released.load());
+        kind = other.kind;
+        status = other.status;
+        result = other.result;
+        return *this;
+    }
+};
+
+// Job parameters for order operations - carried inline in the Job itself.
+// Generic over the engine instantiation so a specialized engine (see
+// BasicOrderEngine) runs through the same scheduler; the OrderJobArgs /
+// Job / JobScheduler aliases below pin the defaults.
+template <typename Engine>
+struct BasicOrderJobArgs
+{
+    Engine* engine;  // Raw pointer - safe because engine lifetime > job lifetime
+    OrderSide side;
+    OrderType type;
+    Price price;
+    Quantity qty;
+    OrderId order_id;
+    OrderId* result_id;
+    bool* result_bool;
+    std::unordered_set<OrderId>* owner_orders; // Caller's ownership set (nullable, node-stable)
+    RequestRecord* record; // Result slot to publish into (nullable)
+    std::atomic<Quantity>* balance; // Submitting user's open-ASK share balance (nullable)
+    std::vector<std::atomic<Quantity>*>* balance_registry; // Engine's order id -> balance table (nullable)
+    Quantity display; // Iceberg display slice (0 for everything else)
+};
+
+// One order of a multi-order batch job. Per-entry pointers carry what
+// normally rides in OrderJobArgs (results, ownership, balances) since
+// entries in one batch may come from different users.
+struct BatchOrderEntry
+{
+    OrderSide side;
+    OrderType type;
+    Price price;
+    Quantity qty;
+    OrderId* result_id;
+    std::unordered_set<OrderId>* owner_orders;
+    std::atomic<Quantity>* balance;
+};
+
+// A whole ticker group submitted as one job: the worker loops place_order
+// over the entries, then frees the array (ownership transfers on submit)
+template <typename Engine>
+struct BasicBatchOrderJobArgs
+{
+    Engine* engine;
+    BatchOrderEntry* entries; // new[]-allocated; deleted after dispatch
+    std::size_t count;
+    std::vector<std::atomic<Quantity>*>* balance_registry;
+};
+
+// What a worker should do with a Job
+enum class JobOp : std::uint8_t
+{
+    None,
+    Generic,     // Run an inline-stored callable
+    PlaceLimit,
+    PlaceMarket,
+    PlaceBatch,  // Loop place_order over a BatchOrderJobArgs entry array
+    Cancel,
+    Edit
+};
+
+// Fixed-size, trivially copyable job: order operations carry their payload
+// inline and are dispatched on the opcode, so submitting an order never
+// touches the heap (the old std::function closures allocated twice per job).
+template <typename Engine>
+struct BasicJob
+{
+    static constexpr std::size_t GENERIC_STORAGE = 48;
+    using GenericFn = void(*)(void*);
+
+    JobOp op;
     std::size_t owner_id;
-    
-    Job() : owner_id(0) {}
-    
-    Job(std::function<void()> exec, std::size_t id)
-    : execute(std::move(exec)), owner_id(id)
+    union
+    {
+        BasicOrderJobArgs<Engine> args;             // Order opcodes
+        BasicBatchOrderJobArgs<Engine> batch_args;  // PlaceBatch opcode
+        unsigned char storage[GENERIC_STORAGE];     // Generic opcode
+    };
+    GenericFn invoke; // Trampoline for Generic jobs
+
+    BasicJob() : op(JobOp::None), owner_id(0), invoke(nullptr) {}
+
+    // Order job: payload copied inline
+    BasicJob(JobOp _op, const BasicOrderJobArgs<Engine>& _args, std::size_t id)
+    : op(_op), owner_id(id), args(_args), invoke(nullptr)
     {}
+
+    // Batch job: entry array ownership moves into the job
+    BasicJob(JobOp _op, const BasicBatchOrderJobArgs<Engine>& _args, std::size_t id)
+    : op(_op), owner_id(id), batch_args(_args), invoke(nullptr)
+    {}
+
+    // Generic job: callable copied into inline storage. Must be trivially
+    // copyable and fit in GENERIC_STORAGE - enforced at compile time.
+    template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, BasicJob>>>
+    BasicJob(F&& fn, std::size_t id)
+    : op(JobOp::Generic), owner_id(id)
+    {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= GENERIC_STORAGE, "Job callable too large for inline storage");
+        static_assert(std::is_trivially_copyable_v<Fn>, "Job callable must be trivially copyable");
+        new (storage) Fn(std::forward<F>(fn));
+        invoke = [](void* s) { (*std::launder(reinterpret_cast<Fn*>(s)))(); };
+    }
 };
 
+// Default-engine instantiations - what every existing caller means
+using OrderJobArgs = BasicOrderJobArgs<OrderEngine>;
+using BatchOrderJobArgs = BasicBatchOrderJobArgs<OrderEngine>;
+using Job = BasicJob<OrderEngine>;
+
 using JobQueue = DoubleBuffer<Job>;
 using WorkerId = std::size_t;
 
-class JobScheduler
+// Plain snapshot of one worker's counters (safe to copy around)
+struct WorkerStats
+{
+    std::uint64_t jobs_executed = 0;
+    std::size_t queue_high_water = 0; // Most jobs ever buffered at once
+    std::uint64_t flush_stalls = 0;   // Flushes that had to spin before swapping
+    std::uint64_t parks = 0;          // Times the worker slept waiting for work
+};
+
+template <typename Engine = OrderEngine>
+class BasicJobScheduler
 {
 public:
-    JobScheduler(std::size_t num_workers = 1, std::size_t batch_capacity = 16384)
+    using Job = BasicJob<Engine>;
+
+private:
+    using JobQueue = DoubleBuffer<Job>;
+
+    // Everything one worker touches on its hot path - queue plus its
+    // counters - lives in one cache-line-aligned block, so adjacent
+    // workers' atomics (write/read cursors, executed counts) never share
+    // a line and never false-share across workers.
+    struct alignas(64) WorkerContext
+    {
+        JobQueue queue;
+        std::atomic<std::uint64_t> jobs_executed{0};
+        std::atomic<std::uint64_t> parks{0}; // Times the worker went to sleep
+
+        // Parking layer: the worker sleeps on work_cv when its queue stays
+        // empty past the spin budget; producers sleep on drain_cv when the
+        // queue stays full or they are waiting for it to empty. The parked
+        // flag and drain_waiters count gate the notify calls, so the busy
+        // path never touches the mutex.
+        std::mutex mutex;
+        std::condition_variable work_cv;
+        std::condition_variable drain_cv;
+        std::atomic<bool> parked{false};
+        std::atomic<std::size_t> drain_waiters{0};
+
+        explicit WorkerContext(std::size_t capacity) noexcept
+        : queue(capacity)
+        {}
+
+        // Move support for vector construction only - contexts never
+        // move once the workers are running, so fresh mutex/condvars are fine
+        WorkerContext(WorkerContext&& other) noexcept
+        : queue(std::move(other.queue)),
+          jobs_executed(other.jobs_executed.load(std::memory_order_relaxed)),
+          parks(other.parks.load(std::memory_order_relaxed))
+        {}
+    };
+
+    // Failed pop/push attempts (each a yield) before sleeping on the
+    // condvar. Large enough that a queue being actively fed never parks.
+    static constexpr std::size_t PARK_SPIN_LIMIT = 4096;
+
+public:
+    // pin_workers pins worker i to core i (mod hardware cores), keeping a
+    // worker's queue and the engines it owns on one core's caches
+    BasicJobScheduler(std::size_t num_workers = 1, std::size_t batch_capacity = 16384, bool pin_workers = false)
     : num_workers_(num_workers), batch_capacity_(batch_capacity)
     {
-        job_queues_.reserve(num_workers_);
-        
+        contexts_.reserve(num_workers_);
+
         // Construct queue object
         for (std::size_t i = 0; i < num_workers_; ++i)
-            job_queues_.emplace_back(batch_capacity_);
-        
+            contexts_.emplace_back(batch_capacity_);
+
         // Start workers
         for (WorkerId i = 0; i < num_workers_; ++i)
+        {
             workers_.emplace_back([this, i]() { worker_loop(i); });
+            if (pin_workers)
+                pin_to_core(workers_.back(), i);
+        }
     }
 
-    JobScheduler(const JobScheduler&) = delete;
-    JobScheduler& operator=(const JobScheduler&) = delete;
-    JobScheduler(JobScheduler&&) = delete;
-    JobScheduler& operator=(JobScheduler&&) = delete;
+    BasicJobScheduler(const BasicJobScheduler&) = delete;
+    BasicJobScheduler& operator=(const BasicJobScheduler&) = delete;
+    BasicJobScheduler(BasicJobScheduler&&) = delete;
+    BasicJobScheduler& operator=(BasicJobScheduler&&) = delete;
 
-    ~JobScheduler()
+    ~BasicJobScheduler()
     {
         execute_batch(); // Execute all pending jobs
         wait_for_completion(); // Wait for jobs workers to finish
         running_.store(false, std::memory_order_seq_cst); // Stop loop
-        
+
+        // Wake any parked workers so they observe the stop flag
+        for (auto& context : contexts_)
+        {
+            std::lock_guard<std::mutex> guard(context.mutex);
+            context.work_cv.notify_one();
+        }
+
         // Join all workers
         for (auto& worker : workers_)
         {
@@ -56,13 +285,33 @@ public:
 
     WorkerId submit_job(Job&& job) noexcept
     {
-        const WorkerId& worker_id = job.owner_id % num_workers_;
-        auto& buffer = job_queues_[worker_id];
-        
-        // If push fails, yeild and retry
-        while (!buffer.try_push(std::move(job))) 
-            std::this_thread::yield();
-        
+        return submit_job(std::move(job), job.owner_id % num_workers_);
+    }
+
+    // Route to an explicit worker (callers that rebalance ownership use this)
+    // Blocking with backpressure: a push can fail transiently (mid-swap flag,
+    // racing producers), which the spin budget absorbs, or because the queue
+    // is genuinely full - then the producer sleeps until a flush makes room
+    // instead of burning its core in a yield loop.
+    WorkerId submit_job(Job&& job, WorkerId worker_id) noexcept
+    {
+        WorkerContext& context = contexts_[worker_id];
+
+        std::size_t spins = 0;
+        while (!context.queue.try_push(std::move(job)))
+        {
+            if (++spins < PARK_SPIN_LIMIT)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(context.mutex);
+            context.drain_waiters.fetch_add(1, std::memory_order_acq_rel);
+            context.drain_cv.wait(lock, [&context]() { return !context.queue.full(); });
+            context.drain_waiters.fetch_sub(1, std::memory_order_acq_rel);
+            spins = 0;
+        }
+
         return worker_id;
     }
 
@@ -71,11 +320,11 @@ public:
         execute_batch();
         wait_for_completion();
     }
-    
+
     void process_jobs_async() noexcept { execute_batch(); }
 
-    void process_jobs_on(WorkerId worker_id) noexcept 
-    { 
+    void process_jobs_on(WorkerId worker_id) noexcept
+    {
         execute_batch(worker_id);
         wait_for_completion(worker_id);
 
@@ -85,66 +334,315 @@ public:
     {
         execute_batch(worker_id);
     }
-    
+
     bool is_complete() const noexcept { return all_queues_empty(); }
-    bool is_worker_complete(WorkerId worker_id) const noexcept { return job_queues_[worker_id].empty(); }
-    std::size_t is_worker_full(WorkerId worker_id) const noexcept { return job_queues_[worker_id].full(); }
-    
+    bool is_worker_complete(WorkerId worker_id) const noexcept { return contexts_[worker_id].queue.empty(); }
+    std::size_t is_worker_full(WorkerId worker_id) const noexcept { return contexts_[worker_id].queue.full(); }
+
     std::size_t get_worker_count() const noexcept { return num_workers_; }
     std::size_t get_batch_capacity() const noexcept { return batch_capacity_; }
-    
+
+    // Run one job on the caller's thread - the dispatch a worker would do,
+    // without the queue crossing. EngineRuntime's inline mode (no workers)
+    // routes every job through here.
+    static void run_inline(Job& job) noexcept { dispatch(job); }
+
+    // Jobs queued (buffered + flushed-but-unread) for one worker
+    std::size_t worker_backlog(WorkerId worker_id) const noexcept
+    {
+        const auto& buffer = contexts_[worker_id].queue;
+        return buffer.pending_writes() + buffer.pending_reads();
+    }
+
+    // Snapshot one worker's counters; reads relaxed atomics only, so it
+    // never stalls the worker or its producers
+    WorkerStats get_worker_stats(WorkerId worker_id) const noexcept
+    {
+        const auto& context = contexts_[worker_id];
+        return WorkerStats{context.jobs_executed.load(std::memory_order_relaxed),
+                           context.queue.high_water(), context.queue.flush_stalls(),
+                           context.parks.load(std::memory_order_relaxed)};
+    }
+
 private:
     void worker_loop(std::size_t worker_id)
     {
+        WorkerContext& context = contexts_[worker_id];
         Job job;
+        std::size_t idle_spins = 0;
         while (running_.load(std::memory_order_acquire))
-        {         
-            // If pop fails then yeild and retry   
-            if (!job_queues_[worker_id].try_pop(job))
+        {
+            if (context.queue.try_pop(job))
+            {
+                dispatch(job);
+                context.jobs_executed.fetch_add(1, std::memory_order_relaxed);
+                idle_spins = 0;
+                continue;
+            }
+
+            // Drained - wake anyone blocked in wait_for_completion
+            if (context.drain_waiters.load(std::memory_order_acquire) > 0 &&
+                context.queue.empty())
+            {
+                std::lock_guard<std::mutex> guard(context.mutex);
+                context.drain_cv.notify_all();
+            }
+
+            // Bounded spin, then park until a flush publishes work. The
+            // predicate re-checks under the mutex, so a flush that lands
+            // between the failed pop and the wait is never missed.
+            if (++idle_spins < PARK_SPIN_LIMIT)
             {
                 std::this_thread::yield();
                 continue;
             }
-            
-            // Execute
-            if (job.execute) 
-                job.execute();            
+            std::unique_lock<std::mutex> lock(context.mutex);
+            context.parked.store(true, std::memory_order_release);
+            context.parks.fetch_add(1, std::memory_order_relaxed);
+            context.work_cv.wait(lock, [this, &context]() {
+                return !running_.load(std::memory_order_acquire) ||
+                       context.queue.pending_reads() > 0;
+            });
+            context.parked.store(false, std::memory_order_release);
+            idle_spins = 0;
+        }
+    }
+
+    // Wake a worker parked on an empty queue (called after a flush). The
+    // parked flag keeps the no-sleeper case lock-free.
+    void wake_worker(WorkerContext& context) noexcept
+    {
+        if (!context.parked.load(std::memory_order_acquire) &&
+            context.drain_waiters.load(std::memory_order_acquire) == 0)
+            return;
+        std::lock_guard<std::mutex> guard(context.mutex);
+        context.work_cv.notify_one();
+        context.drain_cv.notify_all(); // A flush also makes room for blocked producers
+    }
+
+    // Pin a worker thread to a core (best effort - failures are ignored
+    // so the scheduler still runs on restricted cpusets)
+    static void pin_to_core(std::thread& worker, WorkerId worker_id) noexcept
+    {
+        const unsigned int num_cores = std::thread::hardware_concurrency();
+        if (num_cores == 0)
+            return;
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(worker_id % num_cores, &cpuset);
+        pthread_setaffinity_np(worker.native_handle(), sizeof(cpu_set_t), &cpuset);
+    }
+
+    // Single-writer add to an open-ASK balance counter (same idiom as the
+    // engine's trade_volume: the owning worker is the only mutator)
+    static void balance_add(std::atomic<Quantity>* balance, Quantity delta) noexcept
+    {
+        if (!balance || delta == 0)
+            return;
+        balance->store(balance->load(std::memory_order_relaxed) + delta,
+                       std::memory_order_relaxed);
+    }
+
+    // Open-ASK quantity an order currently contributes to its balance
+    static Quantity open_ask_qty(const Engine* engine, OrderId id) noexcept
+    {
+        const OrderInfo* order = engine->get_order(id);
+        if (order && order->status_ == OrderStatus::OPEN && order->side_ == OrderSide::ASK)
+            return order->qty_;
+        return 0;
+    }
+
+    // Publish an order-id result into a request record, if one is attached
+    static void publish_order_id(RequestRecord* record, OrderId id) noexcept
+    {
+        if (!record) return;
+        record->result.order_id = id;
+        record->status = (id != NULL_ORDER) ? RequestStatus::Completed : RequestStatus::Failed;
+        record->ready.store(true, std::memory_order_release);
+    }
+
+    // Run one job on the worker thread, branching on the opcode
+    static void dispatch(Job& job) noexcept
+    {
+        switch (job.op)
+        {
+            case JobOp::PlaceLimit:
+            case JobOp::PlaceMarket:
+            {
+                auto& args = job.args;
+                OrderId id = args.engine->place_order(args.side, args.type, args.price, args.qty, args.display);
+                if (args.result_id)
+                    *args.result_id = id;
+                // Track order ownership
+                if (id != NULL_ORDER && args.owner_orders)
+                    args.owner_orders->insert(id);
+                // Register the order with its balance and credit whatever
+                // rests as an open ASK - including an iceberg's hidden
+                // reserve, which is committed even though only the display
+                // slice rests. Registration happens after placing, so the
+                // order's own fills (handled below via the engine's fill
+                // hook) are never double-counted.
+                if (id != NULL_ORDER && args.balance && args.balance_registry)
+                {
+                    auto& registry = *args.balance_registry;
+                    if (registry.size() <= id)
+                        registry.resize(id + 1, nullptr);
+                    registry[id] = args.balance;
+                    Quantity committed = open_ask_qty(args.engine, id);
+                    if (args.side == OrderSide::ASK)
+                        committed += args.engine->get_hidden_qty(id);
+                    balance_add(args.balance, committed);
+                }
+                publish_order_id(args.record, id);
+                break;
+            }
+            case JobOp::PlaceBatch:
+            {
+                auto& args = job.batch_args;
+                for (std::size_t i = 0; i < args.count; ++i)
+                {
+                    const BatchOrderEntry& entry = args.entries[i];
+                    OrderId id = args.engine->place_order(entry.side, entry.type, entry.price, entry.qty);
+                    if (entry.result_id)
+                        *entry.result_id = id;
+                    if (id != NULL_ORDER && entry.owner_orders)
+                        entry.owner_orders->insert(id);
+                    if (id != NULL_ORDER && entry.balance && args.balance_registry)
+                    {
+                        auto& registry = *args.balance_registry;
+                        if (registry.size() <= id)
+                            registry.resize(id + 1, nullptr);
+                        registry[id] = entry.balance;
+                        balance_add(entry.balance, open_ask_qty(args.engine, id));
+                    }
+                }
+                delete[] args.entries;
+                break;
+            }
+            case JobOp::Cancel:
+            {
+                auto& args = job.args;
+                bool ok = args.engine->cancel_order(args.order_id);
+                if (args.result_bool)
+                    *args.result_bool = ok;
+                // Remove order from tracking if cancel was successful
+                if (ok && args.owner_orders)
+                    args.owner_orders->erase(args.order_id);
+                // Cancelled ASK shares stop counting as sellable
+                if (ok && args.balance_registry &&
+                    args.order_id < args.balance_registry->size() &&
+                    (*args.balance_registry)[args.order_id])
+                {
+                    const OrderInfo* order = args.engine->get_order(args.order_id);
+                    if (order && order->side_ == OrderSide::ASK)
+                        balance_add((*args.balance_registry)[args.order_id], -order->qty_);
+                    (*args.balance_registry)[args.order_id] = nullptr;
+                }
+                if (args.record)
+                {
+                    args.record->result.ok = ok;
+                    args.record->status = ok ? RequestStatus::Completed : RequestStatus::Failed;
+                    args.record->ready.store(true, std::memory_order_release);
+                }
+                break;
+            }
+            case JobOp::Edit:
+            {
+                auto& args = job.args;
+                // Settle the balance across the edit: detach the order from
+                // the fill hook, then apply the open-ASK delta afterwards
+                // (covers re-pricing, side flips and fills on the re-match)
+                std::atomic<Quantity>* balance = nullptr;
+                if (args.balance_registry && args.order_id < args.balance_registry->size())
+                {
+                    balance = (*args.balance_registry)[args.order_id];
+                    (*args.balance_registry)[args.order_id] = nullptr;
+                }
+                // An open ASK iceberg's hidden reserve was credited at
+                // placement, and the edit re-enters as a plain limit with
+                // no reserve - count it into the starting point
+                Quantity before = open_ask_qty(args.engine, args.order_id);
+                if (before > 0)
+                    before += args.engine->get_hidden_qty(args.order_id);
+                OrderId id = args.engine->edit_order(args.order_id, args.side, args.price, args.qty);
+                if (balance)
+                {
+                    balance_add(balance, open_ask_qty(args.engine, args.order_id) - before);
+                    (*args.balance_registry)[args.order_id] = balance;
+                }
+                if (args.result_id)
+                    *args.result_id = id;
+                publish_order_id(args.record, id);
+                break;
+            }
+            case JobOp::Generic:
+            {
+                if (job.invoke)
+                    job.invoke(job.storage);
+                break;
+            }
+            default:
+                break;
         }
     }
 
     void execute_batch() noexcept
     {
-        for (auto& buffer : job_queues_)
-            buffer.flush();
+        for (auto& context : contexts_)
+        {
+            context.queue.flush();
+            wake_worker(context);
+        }
     }
 
-    void execute_batch(WorkerId worker_id) noexcept { job_queues_[worker_id].flush(); }
+    void execute_batch(WorkerId worker_id) noexcept
+    {
+        contexts_[worker_id].queue.flush();
+        wake_worker(contexts_[worker_id]);
+    }
 
     void wait_for_completion() noexcept
     {
-        while (!all_queues_empty())
-            std::this_thread::yield();
+        for (WorkerId i = 0; i < num_workers_; ++i)
+            wait_for_completion(i);
     }
-    
+
+    // Bounded spin, then sleep until the worker reports its queue drained
     void wait_for_completion(WorkerId worker_id) noexcept
     {
-        while (!job_queues_[worker_id].empty())
-            std::this_thread::yield();
+        WorkerContext& context = contexts_[worker_id];
+
+        std::size_t spins = 0;
+        while (!context.queue.empty())
+        {
+            if (++spins < PARK_SPIN_LIMIT)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(context.mutex);
+            context.drain_waiters.fetch_add(1, std::memory_order_acq_rel);
+            context.drain_cv.wait(lock, [&context]() { return context.queue.empty(); });
+            context.drain_waiters.fetch_sub(1, std::memory_order_acq_rel);
+        }
     }
 
     bool all_queues_empty() const noexcept
     {
-        for (const auto& buffer : job_queues_)
+        for (const auto& context : contexts_)
         {
-            if (!buffer.empty())
+            if (!context.queue.empty())
                 return false;
         }
         return true;
     }
 
-    std::vector<JobQueue> job_queues_;
+    std::vector<WorkerContext> contexts_; // One aligned block per worker (fixed at construction)
     std::vector<std::thread> workers_;
     std::size_t num_workers_;
     std::size_t batch_capacity_;
     std::atomic<bool> running_{true};
-};
\ No newline at end of file
+};
+
+// Default scheduler: drives default-instantiation engines
+using JobScheduler = BasicJobScheduler<>;
@@ -0,0 +1,438 @@
+#pragma once
+#include "engine_runtime.cpp"
+#include <fstream>
+#include <sstream>
+
+// Binary market-data replay: a fixed-width capture format, a memory-mapped
+// reader, and a driver that streams a capture file into EngineRuntime with
+// one thread decoding ahead while the calling thread submits. Convert
+// existing CSV captures with convert_csv_capture() below.
+
+constexpr std::uint64_t REPLAY_MAGIC = 0x4C50524E41544954ULL; // "TITANRPL"
+constexpr std::uint32_t REPLAY_VERSION = 1;
+
+// What a capture record asks the runtime to do
+enum class ReplayOp : std::uint8_t
+{
+    PlaceLimit,
+    PlaceMarket,
+    Cancel
+};
+
+// Fixed-width capture record. Written as raw bytes, so the layout is the
+// on-disk format - append new fields at the end and bump REPLAY_VERSION.
+struct ReplayRecord
+{
+    std::uint64_t timestamp; // Capture-relative nanoseconds (informational)
+    std::uint32_t ticker;    // Index into the file's ticker table
+    std::uint32_t user;
+    double price;            // Unused for market and cancel ops
+    double qty;              // Unused for cancel ops
+    std::uint32_t target;    // Cancel: index of the record that placed the order
+    std::uint8_t op;         // ReplayOp
+    std::uint8_t side;       // OrderSide
+    std::uint8_t pad_[2];
+};
+static_assert(sizeof(ReplayRecord) == 40, "ReplayRecord is the on-disk record layout");
+
+// Records start right after the header (8-aligned); the variable-length
+// ticker table is appended after them so records can be streamed out
+// without knowing the table size up front.
+struct ReplayHeader
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t record_size;
+    std::uint64_t count;        // Records in the file (written at close)
+    std::uint64_t table_offset; // Byte offset of the ticker table
+    std::uint32_t ticker_count;
+    std::uint32_t pad_;
+};
+
+// Streaming writer: records go straight to disk, tickers are interned in
+// memory and written as a trailing table at close. Used by the CSV
+// converter and by tests; capture tooling can write the format directly.
+class ReplayWriter
+{
+public:
+    explicit ReplayWriter(const std::string& path)
+    : out_(path, std::ios::binary | std::ios::trunc)
+    {
+        if (!out_)
+            throw std::runtime_error("Replay Open Failed: " + path);
+        ReplayHeader header{}; // Placeholder, rewritten at close
+        out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    ReplayWriter(const ReplayWriter&) = delete;
+    ReplayWriter& operator=(const ReplayWriter&) = delete;
+
+    ~ReplayWriter() { close(); }
+
+    // Intern a ticker name, returning its index for ReplayRecord::ticker
+    std::uint32_t intern_ticker(const std::string& name)
+    {
+        auto it = ticker_ids_.find(name);
+        if (it != ticker_ids_.end())
+            return it->second;
+        const std::uint32_t id = static_cast<std::uint32_t>(tickers_.size());
+        tickers_.push_back(name);
+        ticker_ids_.emplace(name, id);
+        return id;
+    }
+
+    void append(const ReplayRecord& record)
+    {
+        out_.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        ++count_;
+    }
+
+    std::uint64_t size() const noexcept { return count_; }
+
+    // Write the ticker table and the real header, then close the file
+    void close()
+    {
+        if (!out_.is_open())
+            return;
+
+        const std::uint64_t table_offset = sizeof(ReplayHeader) + count_ * sizeof(ReplayRecord);
+        for (const auto& name : tickers_)
+        {
+            const std::uint32_t len = static_cast<std::uint32_t>(name.size());
+            out_.write(reinterpret_cast<const char*>(&len), sizeof(len));
+            out_.write(name.data(), len);
+        }
+
+        ReplayHeader header{};
+        header.magic = REPLAY_MAGIC;
+        header.version = REPLAY_VERSION;
+        header.record_size = sizeof(ReplayRecord);
+        header.count = count_;
+        header.table_offset = table_offset;
+        header.ticker_count = static_cast<std::uint32_t>(tickers_.size());
+        out_.seekp(0);
+        out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out_.close();
+    }
+
+private:
+    std::ofstream out_;
+    std::uint64_t count_ = 0;
+    std::vector<std::string> tickers_;
+    std::unordered_map<std::string, std::uint32_t> ticker_ids_;
+};
+
+// Memory-mapped reader over a capture file: zero-copy record access plus
+// the decoded ticker table. Mirrors JournalReader.
+class ReplayReader
+{
+public:
+    explicit ReplayReader(const std::string& path)
+    {
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0)
+            throw std::runtime_error("Replay Open Failed: " + path);
+
+        struct stat st;
+        if (::fstat(fd_, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(ReplayHeader))
+        {
+            ::close(fd_);
+            throw std::runtime_error("Replay Truncated: " + path);
+        }
+        size_ = st.st_size;
+
+        map_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (map_ == MAP_FAILED)
+        {
+            ::close(fd_);
+            throw std::runtime_error("Replay Map Failed: " + path);
+        }
+
+        ReplayHeader header;
+        std::memcpy(&header, map_, sizeof(header));
+        if (header.magic != REPLAY_MAGIC || header.version != REPLAY_VERSION ||
+            header.record_size != sizeof(ReplayRecord) ||
+            header.table_offset > size_ ||
+            header.count > (header.table_offset - sizeof(header)) / sizeof(ReplayRecord))
+        {
+            ::munmap(map_, size_);
+            ::close(fd_);
+            throw std::runtime_error("Replay Format Mismatch: " + path);
+        }
+        count_ = header.count;
+
+        // Decode the trailing ticker table
+        const char* base = static_cast<const char*>(map_);
+        std::size_t offset = header.table_offset;
+        tickers_.reserve(header.ticker_count);
+        for (std::uint32_t i = 0; i < header.ticker_count; ++i)
+        {
+            std::uint32_t len;
+            if (size_ - offset < sizeof(len))
+                break;
+            std::memcpy(&len, base + offset, sizeof(len));
+            offset += sizeof(len);
+            if (size_ - offset < len)
+                break;
+            tickers_.emplace_back(base + offset, len);
+            offset += len;
+        }
+    }
+
+    ReplayReader(const ReplayReader&) = delete;
+    ReplayReader& operator=(const ReplayReader&) = delete;
+
+    ~ReplayReader()
+    {
+        if (map_)
+            ::munmap(map_, size_);
+        if (fd_ >= 0)
+            ::close(fd_);
+    }
+
+    std::size_t size() const noexcept { return count_; }
+    const std::vector<std::string>& tickers() const noexcept { return tickers_; }
+
+    const ReplayRecord& operator[](std::size_t idx) const noexcept { return records()[idx]; }
+    const ReplayRecord* begin() const noexcept { return records(); }
+    const ReplayRecord* end() const noexcept { return records() + count_; }
+
+private:
+    const ReplayRecord* records() const noexcept
+    {
+        return reinterpret_cast<const ReplayRecord*>(static_cast<const char*>(map_) + sizeof(ReplayHeader));
+    }
+
+    int fd_ = -1;
+    void* map_ = nullptr;
+    std::size_t size_ = 0;
+    std::uint64_t count_ = 0;
+    std::vector<std::string> tickers_;
+};
+
+// Streams a capture file into the runtime. A decode thread validates
+// records and maps file ticker ids to live engines a window ahead; the
+// calling thread pops decoded ops and submits them, pausing whenever the
+// owning worker's queue is full so the matching workers set the pace.
+class ReplayDriver
+{
+public:
+    struct ReplayStats
+    {
+        std::size_t records = 0;   // Records in the file
+        std::size_t submitted = 0; // Ops handed to the runtime
+        std::size_t skipped = 0;   // Unknown tickers, bad ops, unresolved cancels
+    };
+
+    explicit ReplayDriver(EngineRuntime& runtime) noexcept
+    : runtime_(runtime)
+    {}
+
+    bool replay(const std::string& path, ReplayStats* stats = nullptr)
+    {
+        try
+        {
+            ReplayReader reader(path);
+
+            // File ticker index -> live runtime id, resolved once up front
+            std::vector<TickerId> tid_map;
+            tid_map.reserve(reader.tickers().size());
+            for (const auto& name : reader.tickers())
+                tid_map.push_back(runtime_.get_ticker_id(name));
+
+            const std::size_t count = reader.size();
+            ReplayStats result;
+            result.records = count;
+
+            // Order ids resolved by the workers as place jobs execute;
+            // cancels look their targets up here
+            order_ids_.assign(count, NULL_ORDER);
+            ring_.assign(WINDOW, DecodedOp{});
+            produced_.store(0, std::memory_order_relaxed);
+            consumed_.store(0, std::memory_order_relaxed);
+
+            std::thread decoder(&ReplayDriver::decode_ahead, this, reader.begin(), count, std::cref(tid_map));
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                while (produced_.load(std::memory_order_acquire) <= i)
+                    std::this_thread::yield();
+                const DecodedOp op = ring_[i & (WINDOW - 1)];
+                consumed_.store(i + 1, std::memory_order_release);
+
+                if (op.tid == INVALID_TICKER)
+                {
+                    ++result.skipped;
+                    continue;
+                }
+
+                // Backpressure: flush and let the worker drain before
+                // queueing more
+                const WorkerId worker = runtime_.get_worker(op.tid);
+                while (runtime_.is_worker_full(worker))
+                {
+                    runtime_.execute_batch(worker);
+                    std::this_thread::yield();
+                }
+
+                switch (static_cast<ReplayOp>(op.op))
+                {
+                    case ReplayOp::PlaceLimit:
+                        runtime_.limit_order(op.tid, static_cast<OrderSide>(op.side),
+                            op.price, op.qty, &order_ids_[i], op.user);
+                        ++result.submitted;
+                        break;
+                    case ReplayOp::PlaceMarket:
+                        runtime_.market_order(op.tid, static_cast<OrderSide>(op.side),
+                            op.qty, &order_ids_[i], op.user);
+                        ++result.submitted;
+                        break;
+                    case ReplayOp::Cancel:
+                    {
+                        // The target's id materializes when its batch runs;
+                        // drain in-flight jobs before reading it
+                        if (op.target >= i)
+                        {
+                            ++result.skipped;
+                            break;
+                        }
+                        if (order_ids_[op.target] == NULL_ORDER)
+                            runtime_.execute_batch();
+                        const OrderId target_id = order_ids_[op.target];
+                        if (target_id == NULL_ORDER)
+                        {
+                            ++result.skipped; // Target never placed (rejected or skipped)
+                            break;
+                        }
+                        runtime_.cancel_order(op.tid, target_id, nullptr, op.user);
+                        ++result.submitted;
+                        break;
+                    }
+                }
+            }
+
+            decoder.join();
+            runtime_.execute_batch(); // Drain the tail of the stream
+
+            if (stats)
+                *stats = result;
+            return true;
+        }
+        catch(const std::exception& e)
+        {
+            std::cerr << "Replay Error: " << e.what() << '\n';
+            return false;
+        }
+    }
+
+private:
+    // Decoded, runtime-ready op. tid == INVALID_TICKER marks a skip.
+    struct DecodedOp
+    {
+        TickerId tid = INVALID_TICKER;
+        UserId user = 0;
+        Price price = 0;
+        Quantity qty = 0;
+        std::uint32_t target = 0;
+        std::uint8_t op = 0;
+        std::uint8_t side = 0;
+    };
+
+    // Decode-ahead window; power of two so wrap-around is a mask
+    static constexpr std::size_t WINDOW = 1 << 15;
+
+    // Producer side of the pipeline: runs on its own thread, stays at
+    // most WINDOW records ahead of the submitter
+    void decode_ahead(const ReplayRecord* records, std::size_t count,
+        const std::vector<TickerId>& tid_map) noexcept
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            while (i - consumed_.load(std::memory_order_acquire) >= WINDOW)
+                std::this_thread::yield();
+
+            const ReplayRecord& record = records[i];
+            DecodedOp& slot = ring_[i & (WINDOW - 1)];
+            const bool valid = record.ticker < tid_map.size()
+                && tid_map[record.ticker] != INVALID_TICKER
+                && record.op <= static_cast<std::uint8_t>(ReplayOp::Cancel)
+                && record.side <= static_cast<std::uint8_t>(OrderSide::ASK);
+            slot.tid = valid ? tid_map[record.ticker] : INVALID_TICKER;
+            slot.user = record.user;
+            slot.price = record.price;
+            slot.qty = record.qty;
+            slot.target = record.target;
+            slot.op = record.op;
+            slot.side = record.side;
+
+            produced_.store(i + 1, std::memory_order_release);
+        }
+    }
+
+    EngineRuntime& runtime_;
+    std::vector<OrderId> order_ids_;
+    std::vector<DecodedOp> ring_;
+    std::atomic<std::size_t> produced_{0}; // Decoder cursor
+    std::atomic<std::size_t> consumed_{0}; // Submitter cursor
+};
+
+// Convert a CSV capture into the binary replay format. Expected columns:
+//   ticker,op,side,price,qty,timestamp[,user[,target]]
+// op is L (limit), M (market) or C (cancel, where target is the line
+// index of the placing row); side is B or A. Returns records written.
+inline std::size_t convert_csv_capture(const std::string& csv_path, const std::string& out_path)
+{
+    std::ifstream in(csv_path);
+    if (!in)
+        throw std::runtime_error("Capture Open Failed: " + csv_path);
+
+    ReplayWriter writer(out_path);
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::stringstream row(line);
+        std::string ticker, op, side, price, qty, timestamp, user, target;
+        std::getline(row, ticker, ',');
+        std::getline(row, op, ',');
+        std::getline(row, side, ',');
+        std::getline(row, price, ',');
+        std::getline(row, qty, ',');
+        std::getline(row, timestamp, ',');
+        std::getline(row, user, ',');
+        std::getline(row, target, ',');
+        if (ticker.empty() || op.empty())
+            throw std::runtime_error("Capture Bad Row: " + line);
+
+        ReplayRecord record{};
+        record.ticker = writer.intern_ticker(ticker);
+        record.timestamp = timestamp.empty() ? 0 : std::stoull(timestamp);
+        record.user = user.empty() ? 1 : static_cast<UserId>(std::stoul(user));
+        record.side = static_cast<std::uint8_t>(side == "A" ? OrderSide::ASK : OrderSide::BID);
+        switch (op[0])
+        {
+            case 'L':
+                record.op = static_cast<std::uint8_t>(ReplayOp::PlaceLimit);
+                record.price = std::stod(price);
+                record.qty = std::stod(qty);
+                break;
+            case 'M':
+                record.op = static_cast<std::uint8_t>(ReplayOp::PlaceMarket);
+                record.qty = std::stod(qty);
+                break;
+            case 'C':
+                record.op = static_cast<std::uint8_t>(ReplayOp::Cancel);
+                record.target = static_cast<std::uint32_t>(std::stoul(target));
+                break;
+            default:
+                throw std::runtime_error("Capture Bad Op: " + line);
+        }
+        writer.append(record);
+    }
+
+    const std::size_t written = writer.size();
+    writer.close();
+    return written;
+}
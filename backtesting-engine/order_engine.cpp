@@ -1,9 +1,15 @@
 #pragma once
-#include "../tools/heap.cpp"
-#include "../tools/arena.cpp"
+#include "../tools/Heap.cpp"
+#include "../tools/Arena.cpp"
+#include "../tools/event_journal.cpp"
+#include "../tools/candle_engine.cpp"
 #include <random>
+#include <unordered_map>
 #include <unordered_set>
 #include <iostream>
+#include <ctime>
+#include <cmath>
+#include <cstdint>
 
 // Order Status
 enum class OrderStatus : std::uint8_t
@@ -18,7 +24,9 @@ enum class OrderStatus : std::uint8_t
 enum class OrderType : std::uint8_t
 {
     LIMIT,
-    MARKET
+    MARKET,
+    STOP,    // Held in the trigger ladder until the last trade reaches the trigger, then executes as a market order
+    ICEBERG  // Limit order that rests only a display slice, refilled in place from a hidden reserve
 };
 
 // Order Sides
@@ -32,117 +40,430 @@ enum class OrderSide : std::uint8_t
 using OrderId = std::uint32_t;
 using Price = std::double_t;
 using Quantity = std::double_t;
+using Tick = std::int64_t; // Price expressed in whole tick counts
+
+// Sentinel for empty intrusive links
+constexpr OrderId NULL_ORDER = static_cast<OrderId>(-1);
 
 // Order Info
 struct OrderInfo
 {
-    std::time_t time_;
+    std::uint64_t seq_; // Engine-assigned monotonic sequence number (FIFO ordering key)
     Quantity qty_;
     Price price_;
     OrderStatus status_;
     OrderType type_;
     OrderSide side_;
-    
+    OrderId prev_; // Previous resting order in the same price level
+    OrderId next_; // Next resting order in the same price level
+    OrderId status_prev_; // Previous order with the same status
+    OrderId status_next_; // Next order with the same status
+    Tick tick_; // Price level this order rests at, in tick counts
+
     OrderInfo(OrderSide side, OrderType type, Quantity qty, Price price) noexcept
-    : side_(side), type_(type), status_(OrderStatus::OPEN), qty_(qty), price_(price), time_(std::time(nullptr))
+    : side_(side), type_(type), status_(OrderStatus::OPEN), qty_(qty), price_(price), seq_(0),
+      prev_(NULL_ORDER), next_(NULL_ORDER), status_prev_(NULL_ORDER), status_next_(NULL_ORDER), tick_(0)
     {
     }
 };
 
-using OrderLevel = Heap<std::pair<std::time_t, OrderId>, HeapType::MIN>;
-using LevelMap = std::unordered_map<Price, OrderLevel>;
 using OrderArena = Arena<OrderInfo>;
-using BidBook = Heap<Price, HeapType::MAX>;
-using AskBook = Heap<Price, HeapType::MIN>;
 
-class OrderEngine
+// Hot half of the order pool: everything the matching loop and the
+// intrusive level operations stream per order. Splitting these from the
+// cold fields (seq/type/side - read at placement, by queries and by the
+// journal, never per match) cuts the bytes a match drags through cache.
+// Both halves share one id space; OrderInfo stays the full API record.
+struct OrderHot
+{
+    Quantity qty_;
+    Price price_;
+    Tick tick_;        // Price level this order rests at, in tick counts
+    OrderId prev_;     // Previous resting order in the same price level
+    OrderId next_;     // Next resting order in the same price level
+    OrderStatus status_;
+
+    OrderHot(OrderStatus status, Quantity qty, Price price) noexcept
+    : qty_(qty), price_(price), tick_(0), prev_(NULL_ORDER), next_(NULL_ORDER), status_(status)
+    {
+    }
+};
+
+using HotArena = Arena<OrderHot>;
+
+// Intrusive FIFO queue of resting orders at one price.
+// The links live inside the OrderInfo arena slots, so append and
+// unlink-by-id are both O(1), and time-priority is simply append order.
+struct OrderLevel
+{
+    // POST: Append order to the back of the level (lowest time-priority)
+    void append(HotArena& pool, OrderId id) noexcept
+    {
+        OrderHot& order = pool[id];
+        total_qty_ += order.qty_;
+        order.prev_ = tail_;
+        order.next_ = NULL_ORDER;
+        if (tail_ != NULL_ORDER)
+            pool[tail_].next_ = id;
+        else
+            head_ = id;
+        tail_ = id;
+        ++size_;
+    }
+
+    // POST: Unlink order from anywhere in the level by id
+    void unlink(HotArena& pool, OrderId id) noexcept
+    {
+        OrderHot& order = pool[id];
+        total_qty_ -= order.qty_;
+        if (order.prev_ != NULL_ORDER)
+            pool[order.prev_].next_ = order.next_;
+        else
+            head_ = order.next_;
+        if (order.next_ != NULL_ORDER)
+            pool[order.next_].prev_ = order.prev_;
+        else
+            tail_ = order.prev_;
+        order.prev_ = NULL_ORDER;
+        order.next_ = NULL_ORDER;
+        --size_;
+    }
+
+    // POST: Pop the front order (highest time-priority)
+    void pop_front(HotArena& pool) noexcept
+    {
+        if (head_ != NULL_ORDER)
+            unlink(pool, head_);
+    }
+
+    // POST: Knock a partial fill off the running aggregate (the order
+    // stays linked, so append/unlink never see the filled portion)
+    void reduce(Quantity qty) noexcept { total_qty_ -= qty; }
+
+    // GET: Front order id (NULL_ORDER if empty)
+    OrderId front() const noexcept { return head_; }
+
+    // GET: Total resting quantity at this price, maintained incrementally
+    Quantity total_qty() const noexcept { return total_qty_; }
+
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return head_ == NULL_ORDER; }
+
+private:
+    OrderId head_ = NULL_ORDER; // Oldest resting order
+    OrderId tail_ = NULL_ORDER; // Newest resting order
+    std::size_t size_ = 0; // Resting order count
+    Quantity total_qty_ = 0; // Sum of resting qty_ across the level
+};
+
+// Hot-path statistics counters. Each engine has exactly one writer (its
+// owning worker), so every update is a single relaxed increment; readers
+// snapshot them at any time without stopping the matching path.
+struct EngineCounters
+{
+    std::atomic<std::uint64_t> orders_placed{0};
+    std::atomic<std::uint64_t> orders_matched{0};   // Orders fully filled
+    std::atomic<std::uint64_t> orders_cancelled{0};
+    std::atomic<std::uint64_t> orders_rejected{0};
+    std::atomic<std::uint64_t> trades{0};           // Individual match events
+    std::atomic<std::uint64_t> match_iterations{0}; // Match-loop trips
+    std::atomic<Quantity> trade_volume{0.0};        // Shares traded (single writer: load+store)
+};
+
+constexpr std::size_t NUM_ORDER_STATUSES = 4; // OPEN/FILLED/CANCELLED/REJECTED
+
+// Optional per-engine fill callback: invoked synchronously on the
+// matching path, once per matched side, on the engine's owning thread.
+// Plain function pointer + context so attaching it costs nothing when unused.
+using FillHook = void(*)(void* ctx, OrderId id, OrderSide side, Quantity qty);
+
+// Point-in-time top-of-book snapshot, published through a seqlock at the
+// end of every book mutation. Plain values: a reader copies the whole
+// struct and validates the sequence afterwards, so it never touches the
+// live books while the owning worker is matching.
+struct BookTop
+{
+    static constexpr std::size_t DEPTH = 4; // Price levels captured per side
+
+    Price best_bid = -1;
+    Price best_ask = -1;
+    Price last_trade = -1;
+    std::size_t bid_levels = 0; // Valid entries in bids
+    std::size_t ask_levels = 0; // Valid entries in asks
+    std::pair<Price, Quantity> bids[DEPTH];
+    std::pair<Price, Quantity> asks[DEPTH];
+};
+
+constexpr std::uint64_t SNAPSHOT_MAGIC = 0x504E534E41544954ULL; // "TITANSNP"
+constexpr std::uint32_t SNAPSHOT_VERSION = 2; // v2: stop ladders and iceberg reserves
+
+// On-disk header of one engine's snapshot image. The payload that follows
+// is: ticker bytes, the cold pool, the hot pool, the bid and ask level
+// tables as (tick, level) pairs, the stop-ladder level tables, then the
+// iceberg reserve records. Books, status chains and the published top are
+// all derivable, so none of them are serialized.
+struct EngineSnapshotHeader
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t ticker_len;
+    std::uint64_t order_count;
+    std::uint64_t bid_level_count;
+    std::uint64_t ask_level_count;
+    std::uint64_t next_seq;
+    std::uint32_t recent_order_id;
+    std::uint32_t pad_;
+    double tick_size;
+    double last_trade;
+    std::uint64_t orders_placed;
+    std::uint64_t orders_matched;
+    std::uint64_t orders_cancelled;
+    std::uint64_t orders_rejected;
+    std::uint64_t trades;
+    std::uint64_t match_iterations;
+    double trade_volume;
+    std::uint32_t status_head[NUM_ORDER_STATUSES];
+    std::uint64_t status_count[NUM_ORDER_STATUSES];
+    std::uint64_t stop_bid_level_count;
+    std::uint64_t stop_ask_level_count;
+    std::uint64_t iceberg_count;
+};
+
+// Books and levels are keyed by integer tick counts: integer keys hash
+// and compare exactly, so float rounding can never split a price level.
+using LevelMap = std::unordered_map<Tick, OrderLevel>;
+using BidBook = IndexedHeap<Tick, HeapType::MAX>;
+using AskBook = IndexedHeap<Tick, HeapType::MIN>;
+
+// Stop trigger ladders: price-ordered so the next stop to release is a
+// peek, never a scan. Sell stops release as the price falls, so the
+// highest trigger goes first; buy stops are the mirror image.
+using StopAskLadder = IndexedHeap<Tick, HeapType::MAX>;
+using StopBidLadder = IndexedHeap<Tick, HeapType::MIN>;
+
+// Compile-time engine policies. The Runtime variants carry today's
+// constructor flags and their per-order checks; the fixed variants are
+// empty, so a release-build instantiation pays no branch on a flag that
+// is never off and instantiates no notification code at all. The
+// OrderEngine / HeadlessOrderEngine aliases below the class pick the two
+// shipped combinations.
+struct RuntimeMatch // auto_match constructor flag, toggled at runtime
+{
+    static constexpr bool kAlwaysOn = false;
+    bool enabled_ = true;
+};
+
+struct AlwaysMatch // Matching is unconditionally on; the flag compiles away
+{
+    static constexpr bool kAlwaysOn = true;
+};
+
+struct RuntimeNotify // verbose constructor flag, console notifications
+{
+    static constexpr bool kEnabled = true;
+    bool verbose_ = true;
+};
+
+struct SilentNotify // Notification checks compile to constant false
+{
+    static constexpr bool kEnabled = false;
+};
+
+template <typename MatchPolicy = RuntimeMatch, typename NotifyPolicy = RuntimeNotify>
+class BasicOrderEngine
 {
 public:
-    OrderEngine(const std::string& ticker, std::size_t capacity = 1048576, bool verbose = true, bool auto_match = true) noexcept
-    : order_pool_(capacity), recent_order_id_(-1), next_order_id_(0), verbose_(verbose), auto_match_(auto_match), ticker_(ticker), last_trade_price_(-1)
+    // The verbose/auto_match flags only reach the Runtime policies; fixed
+    // policies ignore them, so the signature is the same either way
+    BasicOrderEngine(const std::string& ticker, std::size_t capacity = 1048576, bool verbose = true, bool auto_match = true, Price tick_size = 0.01) noexcept
+    : order_pool_(capacity), hot_pool_(capacity), recent_order_id_(-1), next_order_id_(0), ticker_(ticker), last_trade_price_(-1),
+      tick_size_(tick_size > 0 ? tick_size : 0.01)
     {
+        if constexpr (NotifyPolicy::kEnabled)
+            notify_.verbose_ = verbose;
+        if constexpr (!MatchPolicy::kAlwaysOn)
+            match_.enabled_ = auto_match;
     }
 
-    // POST: Place Limit Order
-    OrderId place_order(OrderSide side, OrderType type, Price price, Quantity qty) noexcept
+    // Convert an external price to its tick count (rounded to the grid)
+    Tick to_ticks(Price price) const noexcept { return static_cast<Tick>(std::llround(price / tick_size_)); }
+
+    // Convert a tick count back to an external price
+    Price to_price(Tick tick) const noexcept { return tick * tick_size_; }
+
+    // GET: Tick Size
+    Price get_tick_size() const noexcept { return tick_size_; }
+
+    // POST: Attach a journal ring - every subsequent event is recorded as a
+    // fixed-width binary record instead of (or in addition to) the console
+    void attach_journal(EventRing* ring, std::uint32_t ticker_id) noexcept
     {
-        const OrderId id = order_pool_.emplace(side, type, qty, price); // Emplace Order and get id
-        OrderInfo& new_order = order_pool_[id]; // Reference Order directly by id
-        
+        journal_ring_ = ring;
+        journal_ticker_id_ = ticker_id;
+    }
+
+    // POST: Attach a strategy event bus ring - the same events the journal
+    // sees also feed the runtime's dispatch thread for strategy callbacks
+    void attach_event_bus(EventRing* ring, std::uint32_t ticker_id) noexcept
+    {
+        bus_ring_ = ring;
+        bus_ticker_id_ = ticker_id;
+    }
+
+    // POST: Attach a trade ring - every executed trade is pushed as a
+    // (price, qty, seq) tick for the candle aggregation thread to fold
+    void attach_trade_ring(TradeRing* ring) noexcept
+    {
+        trade_ring_ = ring;
+    }
+
+    // POST: Attach a fill hook - called on the matching path for each
+    // matched side (runs on the engine's owning thread)
+    void attach_fill_hook(FillHook hook, void* ctx) noexcept
+    {
+        fill_hook_ = hook;
+        fill_hook_ctx_ = ctx;
+    }
+
+    // GET: Ticker
+    const std::string& get_ticker() const noexcept { return ticker_; }
+
+    // GET: Hot-path counters (live - snapshot with relaxed loads)
+    const EngineCounters& get_counters() const noexcept { return counters_; }
+
+    // GET: Price levels currently populated on one side
+    std::size_t get_level_count(OrderSide side) const noexcept
+    {
+        return side == OrderSide::BID ? bid_levels_.size() : ask_levels_.size();
+    }
+
+    // POST: Place Order. For STOP orders price is the trigger; for
+    // ICEBERG orders qty is the total and display is the visible slice
+    // (display of 0, or >= qty, degrades to a plain limit).
+    OrderId place_order(OrderSide side, OrderType type, Price price, Quantity qty, Quantity display = 0) noexcept
+    {
+        const OrderId id = order_pool_.emplace(side, type, qty, price); // Emplace cold record and get id
+        if (id == NULL_ORDER) return NULL_ORDER; // Pool exhausted
+        // Hot half allocates in lockstep - both pools share the id space
+        if (hot_pool_.emplace(OrderStatus::OPEN, qty, price) != id)
+            return NULL_ORDER;
+        next_order_id_ = id + 1; // Advance id watermark (slots are never freed, so ids are sequential)
+        order_pool_[id].seq_ = next_seq_++; // Deterministic arrival order - no clock read
+        status_link(id, OrderStatus::OPEN); // Every order starts OPEN
+        OrderHot& new_order = hot_pool_[id]; // Everything below touches only the hot half
+        new_order.tick_ = to_ticks(price); // Snap price to the tick grid
+        new_order.price_ = to_price(new_order.tick_);
+
         // Price Check
         switch (type)
         {
             case OrderType::LIMIT: // Limit Order
+            case OrderType::ICEBERG: // Iceberg crosses like a limit; only the display slice rests
                 {
                     // If Limit Order is above (BID) or below (ASK) best opposing price, then adjust
-                    if (side == OrderSide::ASK && bid_book_.size() && price < bid_book_.peek())
-                        new_order.price_ = bid_book_.peek(); // Adjust price to best bid
-                    else if (side == OrderSide::BID && ask_book_.size() && price > ask_book_.peek())
-                        new_order.price_ = ask_book_.peek(); // Adjust price to best ask
+                    if (side == OrderSide::ASK && bid_book_.size() && new_order.tick_ < bid_book_.peek())
+                        new_order.price_ = to_price(bid_book_.peek()); // Adjust price to best bid
+                    else if (side == OrderSide::BID && ask_book_.size() && new_order.tick_ > ask_book_.peek())
+                        new_order.price_ = to_price(ask_book_.peek()); // Adjust price to best ask
+
+                    // Arm the display slice; the remainder hides in the
+                    // reserve and refills in place as slices fill
+                    if (type == OrderType::ICEBERG && display > 0 && display < qty)
+                    {
+                        new_order.qty_ = display;
+                        iceberg_state_.emplace(id, IcebergState{qty - display, display});
+                    }
                     break;
                 }
 
+            case OrderType::STOP: // Stop Order
+                {
+                    // The tick is the trigger, not a resting price. The
+                    // order waits in the ladder - nothing below applies
+                    place_stop(id, side, new_order);
+                    if (auto_match_on())
+                        trigger_stops(); // The market may already be past the trigger
+                    return id;
+                }
+
            case OrderType::MARKET: // Market Order
                 {
                     // Check Books
                     if (side == OrderSide::ASK && bid_book_.empty())
                     {
                         update_order_status(id, OrderStatus::REJECTED); // Update Order Status
-                        if (verbose_)
+                        counters_.orders_rejected.fetch_add(1, std::memory_order_relaxed);
+                        journal_event(EventKind::Reject, id, new_order.qty_);
+                        if (verbose_on())
                             notify_reject(id, "NO MARKET LIQUIDITY (BIDS)");
                         return -1; // No bids to match with
                     }
                     if (side == OrderSide::BID && ask_book_.empty())
                     {
                         update_order_status(id, OrderStatus::REJECTED); // Update Order Status
-                        if (verbose_)
+                        counters_.orders_rejected.fetch_add(1, std::memory_order_relaxed);
+                        journal_event(EventKind::Reject, id, new_order.qty_);
+                        if (verbose_on())
                             notify_reject(id, "NO MARKET LIQUIDITY (ASKS)");
                         return -1; // No asks to match with
                     }
 
-                    // If Books, then get best opposing price
-                    new_order.price_ = side == OrderSide::ASK ? bid_book_.peek() : ask_book_.peek();
+                    // If Books, then take the best opposing price. The tick
+                    // must follow the adjusted price: the order is keyed into
+                    // the book by tick, and matching pops from the best level
+                    new_order.tick_ = side == OrderSide::ASK ? bid_book_.peek() : ask_book_.peek();
+                    new_order.price_ = to_price(new_order.tick_);
                     break;
                 }
         }
-        
+
         // Place Order
+        const Tick tick = new_order.tick_;
         switch (side)
         {
             case OrderSide::ASK:
                 {
                     // Create new ask price level if no price level
-                    if (ask_book_.find(price) == -1)
+                    if (ask_book_.find(tick) == -1)
                     {
-                        ask_book_.push(price);
-                        ask_levels_[price] = OrderLevel();
+                        ask_book_.push(tick);
+                        ask_levels_[tick] = OrderLevel();
                     }
-                    ask_levels_[price].emplace(new_order.time_, id);                    
+                    ask_levels_[tick].append(hot_pool_, id);
                     break;
                 }
-            
+
             case OrderSide::BID:
                 {
                     // Create new bid price level if no price level
-                    if (bid_book_.find(price) == -1)
+                    if (bid_book_.find(tick) == -1)
                     {
-                        bid_book_.push(price);
-                        bid_levels_[price] = OrderLevel();
+                        bid_book_.push(tick);
+                        bid_levels_[tick] = OrderLevel();
                     }
-                    bid_levels_[price].emplace(new_order.time_, id);
+                    bid_levels_[tick].append(hot_pool_, id);
                     break;
                 }
-            
+
         }
 
-        if (verbose_)
+        counters_.orders_placed.fetch_add(1, std::memory_order_relaxed);
+        journal_event(EventKind::Open, id, new_order.qty_);
+        if (verbose_on())
             notify_open(id);
         recent_order_id_ = id;
 
         // Attempt to match the new order (if auto-matching is enabled)
-        if (auto_match_)
+        if (auto_match_on())
+        {
             matching_engine();
+            trigger_stops(); // Trades may have reached waiting triggers
+        }
 
+        // Refresh the snapshot unless the order rests strictly below the
+        // captured window (market orders always interact with the top)
+        if (type == OrderType::MARKET || tick_in_top(side, new_order.tick_))
+            publish_top();
         return id; // Return Order ID
     }
 
@@ -153,38 +474,45 @@ public:
         if (id >= next_order_id_)
             return false; // Order does not exist
 
-        OrderInfo& order = order_pool_[id];
-        if (order.status_ != OrderStatus::OPEN || order.type_ != OrderType::LIMIT)
-            return false; // Order is not open and not a limit order
+        OrderHot& order = hot_pool_[id];
+        const OrderInfo& cold = order_pool_[id]; // Side/type live in the cold half
+        if (order.status_ != OrderStatus::OPEN)
+            return false; // Order is not open
+
+        // Untriggered stops wait in the ladder, not the book
+        if (cold.type_ == OrderType::STOP)
+            return cancel_stop(id, order, cold.side_);
+        if (cold.type_ != OrderType::LIMIT && cold.type_ != OrderType::ICEBERG)
+            return false; // Market orders (and released stops) cannot be cancelled
 
         // Get Order's Price Level
-        OrderLevel& price_level = (order.side_ == OrderSide::BID) ? bid_levels_[order.price_] : ask_levels_[order.price_];
-        // Pop Order from level
-        price_level.pop(price_level.find(std::pair<std::time_t, OrderId>(order.time_, id)));
+        OrderLevel& price_level = (cold.side_ == OrderSide::BID) ? bid_levels_[order.tick_] : ask_levels_[order.tick_];
+        // Unlink Order from level (O(1) via intrusive links)
+        price_level.unlink(hot_pool_, id);
 
         // If Price Level is empty pop from Book and erase Price Level
         if (price_level.empty())
         {
-            switch(order.side_)
+            switch(cold.side_)
             {
                 case OrderSide::BID:
                 {
-                    const auto& bid = bid_book_.find(order.price_);
+                    const auto& bid = bid_book_.find(order.tick_);
                     if (bid != -1)
                     {
                         bid_book_.pop(bid);
-                        bid_levels_.erase(order.price_);
+                        bid_levels_.erase(order.tick_);
                     }
                     break;
                 }
 
                 case OrderSide::ASK:
                 {
-                    const auto& ask = ask_book_.find(order.price_);
+                    const auto& ask = ask_book_.find(order.tick_);
                     if (ask != -1)
                     {
                         ask_book_.pop(ask);
-                        ask_levels_.erase(order.price_);
+                        ask_levels_.erase(order.tick_);
                     }
                     break;
                 }
@@ -194,9 +522,26 @@ public:
             }
         }
 
+        // Fold an iceberg's hidden reserve back into the order so the
+        // cancel records the full remainder (the level only ever saw the
+        // display slice, so this comes after the unlink)
+        if (cold.type_ == OrderType::ICEBERG)
+        {
+            auto it = iceberg_state_.find(id);
+            if (it != iceberg_state_.end())
+            {
+                order.qty_ += it->second.hidden_;
+                iceberg_state_.erase(it);
+            }
+        }
+
         update_order_status(id, OrderStatus::CANCELLED); // Update Order Status
-        if (verbose_)
+        counters_.orders_cancelled.fetch_add(1, std::memory_order_relaxed);
+        journal_event(EventKind::Cancel, id, order.qty_);
+        if (verbose_on())
             notify_cancel(id);
+        if (tick_in_top(cold.side_, order.tick_))
+            publish_top(); // The cancel may be visible in the snapshot
         return true; // Order successfully canceled
     }
 
@@ -206,55 +551,61 @@ public:
         if (!cancel_order(id))
         {
             // If order exists, notify reject for modify attempt; otherwise just return
-            if (id < next_order_id_ && verbose_)
+            if (id < next_order_id_ && verbose_on())
                 notify_reject(id, "MODIFY FAILED: COULD NOT CANCEL ORDER");
             return -1; // If cancel failed
         }
 
-        OrderInfo& modified_order = order_pool_[id]; // Reference Order directly by id
+        OrderInfo& cold = order_pool_[id]; // Cold record keeps side/seq
+        OrderHot& modified_order = hot_pool_[id];
 
         // Modify Info
-        modified_order.side_ = side;
+        cold.side_ = side;
+        cold.type_ = OrderType::LIMIT; // An edit re-enters the book as a plain limit
+        cold.seq_ = next_seq_++; // Re-priced order loses its time priority
         modified_order.qty_ = qty;
-        modified_order.price_ = price;
-        modified_order.time_ = std::time(nullptr); // Update timestamp
-    
+        modified_order.tick_ = to_ticks(price);
+        modified_order.price_ = to_price(modified_order.tick_);
+
         // Price Check
-        if (side == OrderSide::ASK && bid_book_.size() && price < bid_book_.peek())
-            modified_order.price_ = bid_book_.peek(); // Adjust price to best bid
-        else if (side == OrderSide::BID && ask_book_.size() && price > ask_book_.peek())
-            modified_order.price_ = ask_book_.peek(); // Adjust price to best ask
-        
+        if (side == OrderSide::ASK && bid_book_.size() && modified_order.tick_ < bid_book_.peek())
+            modified_order.price_ = to_price(bid_book_.peek()); // Adjust price to best bid
+        else if (side == OrderSide::BID && ask_book_.size() && modified_order.tick_ > ask_book_.peek())
+            modified_order.price_ = to_price(ask_book_.peek()); // Adjust price to best ask
+
         // Place Order
+        const Tick tick = modified_order.tick_;
         switch (side)
         {
             case OrderSide::ASK:
                 {
                     // Create modified ask price level if no price level
-                    if (ask_book_.find(price) == -1)
+                    if (ask_book_.find(tick) == -1)
                     {
-                        ask_book_.push(price);
-                        ask_levels_[price] = OrderLevel();
+                        ask_book_.push(tick);
+                        ask_levels_[tick] = OrderLevel();
                     }
-                    ask_levels_[price].emplace(modified_order.time_, id);                    
+                    ask_levels_[tick].append(hot_pool_, id);
                     break;
                 }
-            
+
             case OrderSide::BID:
                 {
                     // Create modified bid price level if no price level
-                    if (bid_book_.find(price) == -1)
+                    if (bid_book_.find(tick) == -1)
                     {
-                        bid_book_.push(price);
-                        bid_levels_[price] = OrderLevel();
+                        bid_book_.push(tick);
+                        bid_levels_[tick] = OrderLevel();
                     }
-                    bid_levels_[price].emplace(modified_order.time_, id);
+                    bid_levels_[tick].append(hot_pool_, id);
                     break;
                 }
             
             default:
                 update_order_status(id, OrderStatus::REJECTED); // Update Order Status
-                if (verbose_)
+                counters_.orders_rejected.fetch_add(1, std::memory_order_relaxed);
+                journal_event(EventKind::Reject, id, modified_order.qty_);
+                if (verbose_on())
                     notify_reject(id, "INVALID ORDER SIDE");
                 return -1; // Invalid Order Side
         }
@@ -262,28 +613,363 @@ public:
         update_order_status(id, OrderStatus::OPEN); // Update Order Status
         recent_order_id_ = id;
 
-        if (verbose_)
+        journal_event(EventKind::Modify, id, modified_order.qty_);
+        if (verbose_on())
             notify_modify(id);
         
         // Attempt to match the modified order (if auto-matching is enabled)
-        if (auto_match_)
+        if (auto_match_on())
+        {
             matching_engine();
-        
+            trigger_stops(); // Trades may have reached waiting triggers
+        }
+
+        publish_top(); // Refresh the concurrent top-of-book snapshot
         return id; // Return Order ID
     }
 
-    // POST: Set Auto Match Flag
-    void set_auto_match(bool auto_match) noexcept { auto_match_ = auto_match; }
+    // POST: Set Auto Match Flag (runtime-match engines only - a fixed
+    // policy has no flag to set, and calling this refuses to compile)
+    void set_auto_match(bool auto_match) noexcept
+    {
+        static_assert(!MatchPolicy::kAlwaysOn, "auto-match is fixed on for this engine instantiation");
+        match_.enabled_ = auto_match;
+    }
 
     // GET: Get Auto Match Flag
-    bool get_auto_match() const noexcept { return auto_match_; }
+    bool get_auto_match() const noexcept { return auto_match_on(); }
 
     // GET: Get Order
     const OrderInfo* get_order(const unsigned int& id) const noexcept
     { 
             if (id >= next_order_id_)
                 return nullptr; // NULL if no order
-            return &order_pool_[id]; 
+            // Sync the hot half into the stable cold record before handing
+            // it out - callers keep holding plain OrderInfo pointers
+            OrderInfo& rec = order_pool_[id];
+            const OrderHot& hot = hot_pool_[id];
+            rec.qty_ = hot.qty_;
+            rec.price_ = hot.price_;
+            rec.status_ = hot.status_;
+            rec.prev_ = hot.prev_;
+            rec.next_ = hot.next_;
+            rec.tick_ = hot.tick_;
+            return &rec; 
+    }
+
+    // GET: Top-of-book snapshot - safe to call from any thread. Spins
+    // while a publish is in progress and retries if one raced the copy,
+    // so a torn read can never escape; the live books are never touched.
+    BookTop get_top_of_book() const noexcept
+    {
+        BookTop snapshot;
+        for (;;)
+        {
+            const std::uint64_t before = top_seq_.load(std::memory_order_acquire);
+            if (before & 1)
+                continue; // Publish in progress - retry
+            snapshot = top_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (top_seq_.load(std::memory_order_relaxed) == before)
+                return snapshot;
+        }
+    }
+
+    // GET: Bytes needed to serialize this engine's snapshot image
+    std::size_t snapshot_size() const noexcept
+    {
+        return sizeof(EngineSnapshotHeader) + ticker_.size()
+             + static_cast<std::size_t>(next_order_id_) * (sizeof(OrderInfo) + sizeof(OrderHot))
+             + bid_levels_.size() * (sizeof(Tick) + sizeof(OrderLevel))
+             + ask_levels_.size() * (sizeof(Tick) + sizeof(OrderLevel))
+             + stop_bid_levels_.size() * (sizeof(Tick) + sizeof(OrderLevel))
+             + stop_ask_levels_.size() * (sizeof(Tick) + sizeof(OrderLevel))
+             + iceberg_state_.size() * (sizeof(OrderId) + 2 * sizeof(Quantity));
+    }
+
+    // POST: Serialize the full book state into dst (at least
+    // snapshot_size() bytes). Returns bytes written. Arena-index links
+    // mean the pools are position-independent - no pointers to fix up.
+    std::size_t save_snapshot(unsigned char* dst) const noexcept
+    {
+        EngineSnapshotHeader header{};
+        header.magic = SNAPSHOT_MAGIC;
+        header.version = SNAPSHOT_VERSION;
+        header.ticker_len = static_cast<std::uint32_t>(ticker_.size());
+        header.order_count = next_order_id_;
+        header.bid_level_count = bid_levels_.size();
+        header.ask_level_count = ask_levels_.size();
+        header.next_seq = next_seq_;
+        header.recent_order_id = recent_order_id_;
+        header.tick_size = tick_size_;
+        header.last_trade = last_trade_price_;
+        header.orders_placed = counters_.orders_placed.load(std::memory_order_relaxed);
+        header.orders_matched = counters_.orders_matched.load(std::memory_order_relaxed);
+        header.orders_cancelled = counters_.orders_cancelled.load(std::memory_order_relaxed);
+        header.orders_rejected = counters_.orders_rejected.load(std::memory_order_relaxed);
+        header.trades = counters_.trades.load(std::memory_order_relaxed);
+        header.match_iterations = counters_.match_iterations.load(std::memory_order_relaxed);
+        header.trade_volume = counters_.trade_volume.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i < NUM_ORDER_STATUSES; ++i)
+        {
+            header.status_head[i] = status_index_[i].head;
+            header.status_count[i] = status_index_[i].count;
+        }
+        header.stop_bid_level_count = stop_bid_levels_.size();
+        header.stop_ask_level_count = stop_ask_levels_.size();
+        header.iceberg_count = iceberg_state_.size();
+
+        std::size_t offset = 0;
+        std::memcpy(dst, &header, sizeof(header));
+        offset += sizeof(header);
+        std::memcpy(dst + offset, ticker_.data(), ticker_.size());
+        offset += ticker_.size();
+
+        for (OrderId id = 0; id < next_order_id_; ++id)
+        {
+            std::memcpy(dst + offset, &order_pool_[id], sizeof(OrderInfo));
+            offset += sizeof(OrderInfo);
+        }
+        for (OrderId id = 0; id < next_order_id_; ++id)
+        {
+            std::memcpy(dst + offset, &hot_pool_[id], sizeof(OrderHot));
+            offset += sizeof(OrderHot);
+        }
+
+        for (const auto& [tick, level] : bid_levels_)
+        {
+            std::memcpy(dst + offset, &tick, sizeof(Tick));
+            offset += sizeof(Tick);
+            std::memcpy(dst + offset, &level, sizeof(OrderLevel));
+            offset += sizeof(OrderLevel);
+        }
+        for (const auto& [tick, level] : ask_levels_)
+        {
+            std::memcpy(dst + offset, &tick, sizeof(Tick));
+            offset += sizeof(Tick);
+            std::memcpy(dst + offset, &level, sizeof(OrderLevel));
+            offset += sizeof(OrderLevel);
+        }
+
+        // v2: stop-ladder level tables (the ladders themselves are
+        // re-heapified from the keys, just like the books)
+        for (const auto& [tick, level] : stop_bid_levels_)
+        {
+            std::memcpy(dst + offset, &tick, sizeof(Tick));
+            offset += sizeof(Tick);
+            std::memcpy(dst + offset, &level, sizeof(OrderLevel));
+            offset += sizeof(OrderLevel);
+        }
+        for (const auto& [tick, level] : stop_ask_levels_)
+        {
+            std::memcpy(dst + offset, &tick, sizeof(Tick));
+            offset += sizeof(Tick);
+            std::memcpy(dst + offset, &level, sizeof(OrderLevel));
+            offset += sizeof(OrderLevel);
+        }
+
+        // v2: iceberg reserves as (id, hidden, display) records
+        for (const auto& [id, state] : iceberg_state_)
+        {
+            std::memcpy(dst + offset, &id, sizeof(OrderId));
+            offset += sizeof(OrderId);
+            std::memcpy(dst + offset, &state.hidden_, sizeof(Quantity));
+            offset += sizeof(Quantity);
+            std::memcpy(dst + offset, &state.display_, sizeof(Quantity));
+            offset += sizeof(Quantity);
+        }
+
+        return offset;
+    }
+
+    // POST: Rebuild this engine from a save_snapshot image, discarding
+    // the current contents. Returns bytes consumed, or 0 on a bad image.
+    std::size_t load_snapshot(const unsigned char* src, std::size_t len) noexcept
+    {
+        EngineSnapshotHeader header;
+        if (len < sizeof(header))
+            return 0;
+        std::memcpy(&header, src, sizeof(header));
+        if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION)
+            return 0;
+
+        const std::size_t need = sizeof(header) + header.ticker_len
+            + header.order_count * (sizeof(OrderInfo) + sizeof(OrderHot))
+            + (header.bid_level_count + header.ask_level_count
+               + header.stop_bid_level_count + header.stop_ask_level_count) * (sizeof(Tick) + sizeof(OrderLevel))
+            + header.iceberg_count * (sizeof(OrderId) + 2 * sizeof(Quantity));
+        if (len < need)
+            return 0;
+
+        // Discard current state (arena blocks are kept for reuse)
+        order_pool_.reset();
+        hot_pool_.reset();
+        bid_book_ = BidBook();
+        ask_book_ = AskBook();
+        bid_levels_.clear();
+        ask_levels_.clear();
+        stop_bid_book_ = StopBidLadder();
+        stop_ask_book_ = StopAskLadder();
+        stop_bid_levels_.clear();
+        stop_ask_levels_.clear();
+        iceberg_state_.clear();
+
+        std::size_t offset = sizeof(header);
+        ticker_.assign(reinterpret_cast<const char*>(src + offset), header.ticker_len);
+        offset += header.ticker_len;
+
+        tick_size_ = header.tick_size;
+        last_trade_price_ = header.last_trade;
+        next_order_id_ = static_cast<OrderId>(header.order_count);
+        next_seq_ = header.next_seq;
+        recent_order_id_ = header.recent_order_id;
+
+        // The image may be unaligned (it sits behind an arbitrary offset
+        // in a mapped file), so every record goes through a local copy
+        for (OrderId id = 0; id < next_order_id_; ++id)
+        {
+            OrderInfo record(OrderSide::BID, OrderType::LIMIT, 0, 0);
+            std::memcpy(&record, src + offset, sizeof(OrderInfo));
+            offset += sizeof(OrderInfo);
+            if (order_pool_.emplace(std::move(record)) != id)
+                return 0; // Fresh arenas hand out dense ids
+        }
+        for (OrderId id = 0; id < next_order_id_; ++id)
+        {
+            OrderHot record(OrderStatus::OPEN, 0, 0);
+            std::memcpy(&record, src + offset, sizeof(OrderHot));
+            offset += sizeof(OrderHot);
+            if (hot_pool_.emplace(std::move(record)) != id)
+                return 0;
+        }
+
+        // Level tables come back verbatim; the books are re-heapified
+        // from their keys
+        for (std::uint64_t i = 0; i < header.bid_level_count; ++i)
+        {
+            Tick tick;
+            OrderLevel level;
+            std::memcpy(&tick, src + offset, sizeof(Tick));
+            offset += sizeof(Tick);
+            std::memcpy(&level, src + offset, sizeof(OrderLevel));
+            offset += sizeof(OrderLevel);
+            bid_levels_.emplace(tick, level);
+            bid_book_.push(tick);
+        }
+        for (std::uint64_t i = 0; i < header.ask_level_count; ++i)
+        {
+            Tick tick;
+            OrderLevel level;
+            std::memcpy(&tick, src + offset, sizeof(Tick));
+            offset += sizeof(Tick);
+            std::memcpy(&level, src + offset, sizeof(OrderLevel));
+            offset += sizeof(OrderLevel);
+            ask_levels_.emplace(tick, level);
+            ask_book_.push(tick);
+        }
+        for (std::uint64_t i = 0; i < header.stop_bid_level_count; ++i)
+        {
+            Tick tick;
+            OrderLevel level;
+            std::memcpy(&tick, src + offset, sizeof(Tick));
+            offset += sizeof(Tick);
+            std::memcpy(&level, src + offset, sizeof(OrderLevel));
+            offset += sizeof(OrderLevel);
+            stop_bid_levels_.emplace(tick, level);
+            stop_bid_book_.push(tick);
+        }
+        for (std::uint64_t i = 0; i < header.stop_ask_level_count; ++i)
+        {
+            Tick tick;
+            OrderLevel level;
+            std::memcpy(&tick, src + offset, sizeof(Tick));
+            offset += sizeof(Tick);
+            std::memcpy(&level, src + offset, sizeof(OrderLevel));
+            offset += sizeof(OrderLevel);
+            stop_ask_levels_.emplace(tick, level);
+            stop_ask_book_.push(tick);
+        }
+        for (std::uint64_t i = 0; i < header.iceberg_count; ++i)
+        {
+            OrderId id;
+            IcebergState state{0, 0};
+            std::memcpy(&id, src + offset, sizeof(OrderId));
+            offset += sizeof(OrderId);
+            std::memcpy(&state.hidden_, src + offset, sizeof(Quantity));
+            offset += sizeof(Quantity);
+            std::memcpy(&state.display_, src + offset, sizeof(Quantity));
+            offset += sizeof(Quantity);
+            iceberg_state_.emplace(id, state);
+        }
+
+        counters_.orders_placed.store(header.orders_placed, std::memory_order_relaxed);
+        counters_.orders_matched.store(header.orders_matched, std::memory_order_relaxed);
+        counters_.orders_cancelled.store(header.orders_cancelled, std::memory_order_relaxed);
+        counters_.orders_rejected.store(header.orders_rejected, std::memory_order_relaxed);
+        counters_.trades.store(header.trades, std::memory_order_relaxed);
+        counters_.match_iterations.store(header.match_iterations, std::memory_order_relaxed);
+        counters_.trade_volume.store(header.trade_volume, std::memory_order_relaxed);
+        for (std::size_t i = 0; i < NUM_ORDER_STATUSES; ++i)
+        {
+            status_index_[i].head = header.status_head[i];
+            status_index_[i].count = header.status_count[i];
+        }
+
+        publish_top(); // Snapshot readers see the restored book
+        return offset;
+    }
+
+    // POST: Turn this engine into a copy-on-write fork of source,
+    // discarding current contents. The order pools share their arena
+    // blocks and copy each block privately on first write, so the fork
+    // costs the level tables and block table - not the orders - and a
+    // deep book forks in microseconds. The source keeps matching normally
+    // (its own writes also unshare blocks). Forks are scratch engines for
+    // what-if evaluation: journal, event bus, fill hook and trade ring
+    // attachments are not inherited, so hypothetical trades never reach
+    // the real feeds.
+    void fork_from(BasicOrderEngine& source) noexcept
+    {
+        order_pool_ = source.order_pool_.fork();
+        hot_pool_ = source.hot_pool_.fork();
+        ask_book_ = source.ask_book_;
+        bid_book_ = source.bid_book_;
+        ask_levels_ = source.ask_levels_;
+        bid_levels_ = source.bid_levels_;
+        stop_ask_book_ = source.stop_ask_book_;
+        stop_bid_book_ = source.stop_bid_book_;
+        stop_ask_levels_ = source.stop_ask_levels_;
+        stop_bid_levels_ = source.stop_bid_levels_;
+        iceberg_state_ = source.iceberg_state_;
+
+        recent_order_id_ = source.recent_order_id_;
+        next_order_id_ = source.next_order_id_;
+        match_ = source.match_;
+        notify_ = source.notify_;
+        ticker_ = source.ticker_;
+        last_trade_price_ = source.last_trade_price_;
+        tick_size_ = source.tick_size_;
+        next_seq_ = source.next_seq_;
+        for (std::size_t i = 0; i < NUM_ORDER_STATUSES; ++i)
+            status_index_[i] = source.status_index_[i];
+
+        journal_ring_ = nullptr;
+        journal_ticker_id_ = 0;
+        bus_ring_ = nullptr;
+        bus_ticker_id_ = 0;
+        trade_ring_ = nullptr;
+        fill_hook_ = nullptr;
+        fill_hook_ctx_ = nullptr;
+
+        counters_.orders_placed.store(source.counters_.orders_placed.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        counters_.orders_matched.store(source.counters_.orders_matched.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        counters_.orders_cancelled.store(source.counters_.orders_cancelled.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        counters_.orders_rejected.store(source.counters_.orders_rejected.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        counters_.trades.store(source.counters_.trades.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        counters_.match_iterations.store(source.counters_.match_iterations.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        counters_.trade_volume.store(source.counters_.trade_volume.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        publish_top(); // The fork's readers see the cloned book
     }
 
     // GET: Market Price (last trade price)
@@ -292,113 +978,502 @@ public:
         return last_trade_price_;
     }
 
+    // GET: Hidden (not yet displayed) remainder of an iceberg order.
+    // 0 for everything else - get_order only ever reports the display slice.
+    Quantity get_hidden_qty(OrderId id) const noexcept
+    {
+        auto it = iceberg_state_.find(id);
+        return it == iceberg_state_.end() ? 0 : it->second.hidden_;
+    }
+
+    // GET: Stop orders currently waiting in the trigger ladder
+    std::size_t get_pending_stop_count() const noexcept
+    {
+        std::size_t count = 0;
+        for (const auto& [tick, level] : stop_bid_levels_)
+            count += level.size();
+        for (const auto& [tick, level] : stop_ask_levels_)
+            count += level.size();
+        return count;
+    }
+
     // GET: Best Ask
     Price get_best_ask() const noexcept
     {
         if (ask_book_.empty()) return -1;
-        return ask_book_.peek();
+        return to_price(ask_book_.peek());
     }
 
     // GET: Best Bid
     Price get_best_bid() const noexcept
     {
         if (bid_book_.empty()) return -1;
-        return bid_book_.peek();
+        return to_price(bid_book_.peek());
     }
 
-    // GET: Orders by Status - scan order_pool_ and collect matching ids
+    // GET: Orders by Status - walk the intrusive per-status list, so the
+    // cost is O(matching orders) instead of O(every order ever placed)
     std::unordered_set<OrderId> get_orders_by_status(OrderStatus status) const
     {
+        const StatusIndex& index = status_index_[static_cast<std::size_t>(status)];
         std::unordered_set<OrderId> result;
-        for (OrderId id = 0; id < next_order_id_; ++id)
-        {
-            const OrderInfo& ord = order_pool_[id];
-            if (ord.status_ == status)
-                result.insert(id);
-        }
+        result.reserve(index.count);
+        for (OrderId id = index.head; id != NULL_ORDER; id = order_pool_[id].status_next_)
+            result.insert(id);
         return result;
     }
+
+    // GET: How many orders currently carry a status - O(1)
+    std::size_t get_status_count(OrderStatus status) const noexcept
+    {
+        return status_index_[static_cast<std::size_t>(status)].count;
+    }
     
-    // GET: Maket Depth
-    std::vector<std::pair<Price, Quantity>> get_market_depth(OrderSide side, std::size_t depth = 10) const
+    // GET: Market depth into a caller-provided buffer - zero copies and
+    // zero allocations. Each step scans the book for the next-best tick
+    // (the book holds one entry per level, so the scan is short) and reads
+    // that level's running aggregate instead of walking its orders.
+    std::size_t get_market_depth(OrderSide side, std::pair<Price, Quantity>* out, std::size_t depth) const noexcept
     {
-        std::vector<std::pair<Price, Quantity>> depth_result;
+        std::size_t count = 0;
+        Tick prev = 0;
 
         switch(side)
         {
             case OrderSide::BID:
                 {
-                    BidBook tmp_book = bid_book_; // Copy BidsBook
-                    for (size_t i = 0; i < depth && tmp_book.size(); ++i)
+                    while (count < depth)
                     {
-                        Price best_bid = tmp_book.peek(); // Get Best Bid Price
-                        OrderLevel best_level = bid_levels_.at(best_bid); // Get Best Bid Level
-
-                        Quantity total_qty = 0;
-                        // Sum up all Quantities on current price level
-                        while (best_level.size() > 0)
+                        bool found = false;
+                        Tick best = 0;
+                        // Next-best bid: the largest tick below the last one emitted
+                        for (int i = 0; i < bid_book_.size(); ++i)
                         {
-                            OrderId oid = best_level.peek().second;
-                            if (oid < next_order_id_)
-                                total_qty += order_pool_[oid].qty_;
-                            best_level.pop();
+                            const Tick t = bid_book_.peek(i);
+                            if (count && t >= prev) continue;
+                            if (!found || t > best) { best = t; found = true; }
                         }
-
-                        depth_result.emplace_back(best_bid, total_qty);
-                        tmp_book.pop();
+                        if (!found) break;
+                        out[count++] = { to_price(best), bid_levels_.at(best).total_qty() };
+                        prev = best;
                     }
                     break;
                 }
 
             case OrderSide::ASK:
                 {
-                    AskBook tmp_book = ask_book_; // Copy AsksBook
-                    for (size_t i = 0; i < depth && tmp_book.size(); ++i)
+                    while (count < depth)
                     {
-                        Price best_ask = tmp_book.peek(); // Get Best Ask Price
-                        OrderLevel best_level = ask_levels_.at(best_ask); // Get Best Ask Level
-
-                        Quantity total_qty = 0;
-                        // Sum up all Quantities on current price level
-                        while (best_level.size() > 0)
+                        bool found = false;
+                        Tick best = 0;
+                        // Next-best ask: the smallest tick above the last one emitted
+                        for (int i = 0; i < ask_book_.size(); ++i)
                         {
-                            OrderId oid = best_level.peek().second;
-                            if (oid < next_order_id_)
-                                total_qty += order_pool_[oid].qty_;
-                            best_level.pop();
+                            const Tick t = ask_book_.peek(i);
+                            if (count && t <= prev) continue;
+                            if (!found || t < best) { best = t; found = true; }
                         }
-
-                        depth_result.emplace_back(best_ask, total_qty);
-                        tmp_book.pop();
+                        if (!found) break;
+                        out[count++] = { to_price(best), ask_levels_.at(best).total_qty() };
+                        prev = best;
                     }
                     break;
                 }
         }
 
+        return count;
+    }
+
+    // GET: Maket Depth (allocating convenience wrapper)
+    std::vector<std::pair<Price, Quantity>> get_market_depth(OrderSide side, std::size_t depth = 10) const
+    {
+        std::vector<std::pair<Price, Quantity>> depth_result(depth);
+        depth_result.resize(get_market_depth(side, depth_result.data(), depth));
         return depth_result;
     }
 
 private:
     // Order Book
-    OrderArena order_pool_; // Memory Pool for Orders (must be first for constructor)
+    // Cold half: seq/type/side plus the stable OrderInfo records the query
+    // API hands out (mutable: the const accessors sync hot fields into them)
+    mutable OrderArena order_pool_;
+    HotArena hot_pool_; // Hot half: qty/price/status and the level links
     AskBook ask_book_; // Asks Order Book
     BidBook bid_book_; // Bids Order Book
     LevelMap ask_levels_; // Asks Price Levels
     LevelMap bid_levels_; // Bids Price Levels
+    StopAskLadder stop_ask_book_; // Sell-stop triggers (highest first)
+    StopBidLadder stop_bid_book_; // Buy-stop triggers (lowest first)
+    LevelMap stop_ask_levels_; // Sell stops waiting at each trigger tick
+    LevelMap stop_bid_levels_; // Buy stops waiting at each trigger tick
     OrderId recent_order_id_; // Recent Order ID
     OrderId next_order_id_; // Next Order ID
-    bool verbose_; // Verbose Mode
-    bool auto_match_; // Auto Matching Flag
+    MatchPolicy match_; // Auto-matching policy state (empty when fixed on)
+    NotifyPolicy notify_; // Notification policy state (empty when silent)
     std::string ticker_; // Ticker
     Price last_trade_price_; // Last trade execution price
+    Price tick_size_; // Price increment one tick represents
+    std::uint64_t next_seq_ = 0; // Monotonic sequence counter for order arrival
+    EventRing* journal_ring_ = nullptr; // Binary event journal ring (optional)
+    std::uint32_t journal_ticker_id_ = 0; // Interned id stamped on journal records
+    EventRing* bus_ring_ = nullptr; // Strategy event bus ring (optional)
+    std::uint32_t bus_ticker_id_ = 0; // Interned id stamped on bus records
+    TradeRing* trade_ring_ = nullptr; // Candle aggregation trade feed (optional)
+    FillHook fill_hook_ = nullptr; // Optional matching-path fill callback
+    void* fill_hook_ctx_ = nullptr; // Opaque context passed to the hook
+
+    // Per-status intrusive list heads and counts, maintained by
+    // update_order_status (orders chain through their cold slots)
+    struct StatusIndex
+    {
+        OrderId head = NULL_ORDER;
+        std::size_t count = 0;
+    };
+    StatusIndex status_index_[NUM_ORDER_STATUSES];
+
+    // Hidden reserve of an iceberg order. Lives in a side table rather
+    // than OrderHot so the matching loop's cache footprint only pays for
+    // it on the (rare) slice-exhausted path.
+    struct IcebergState
+    {
+        Quantity hidden_;  // Reserve not yet displayed
+        Quantity display_; // Slice size each refill re-arms
+    };
+    std::unordered_map<OrderId, IcebergState> iceberg_state_;
+
+    // Seqlock-published top-of-book (odd sequence = publish in flight)
+    BookTop top_;
+    std::atomic<std::uint64_t> top_seq_{0};
+    EngineCounters counters_; // Hot-path statistics (single writer)
     
-    // Helper: Update order status and maintain status map
+    // Helper: Is auto-matching on? A fixed policy compiles this to a
+    // constant and the per-order branch disappears.
+    bool auto_match_on() const noexcept
+    {
+        if constexpr (MatchPolicy::kAlwaysOn)
+            return true;
+        else
+            return match_.enabled_;
+    }
+
+    // Helper: Is console notification on? A silent policy compiles this
+    // to constant false, so every notify call site - and the notify code
+    // behind it - drops out of the build.
+    bool verbose_on() const noexcept
+    {
+        if constexpr (NotifyPolicy::kEnabled)
+            return notify_.verbose_;
+        else
+            return false;
+    }
+
+    // Helper: Can a mutation at this tick show up in the snapshot? False
+    // only when the tick is strictly worse than the worst captured level
+    // on a side whose capture is already full - such an order can neither
+    // enter the published window nor have crossed the opposite side.
+    bool tick_in_top(OrderSide side, Tick tick) const noexcept
+    {
+        if (side == OrderSide::BID)
+            return top_.bid_levels < BookTop::DEPTH ||
+                   to_price(tick) >= top_.bids[BookTop::DEPTH - 1].first;
+        return top_.ask_levels < BookTop::DEPTH ||
+               to_price(tick) <= top_.asks[BookTop::DEPTH - 1].first;
+    }
+
+    // Helper: Publish the top-of-book snapshot through the seqlock.
+    // Runs on the engine's owning thread after every book mutation; the
+    // odd sequence value tells concurrent readers a write is in flight.
+    void publish_top() noexcept
+    {
+        const std::uint64_t seq = top_seq_.load(std::memory_order_relaxed);
+        top_seq_.store(seq + 1, std::memory_order_relaxed); // Odd: write begins
+        std::atomic_thread_fence(std::memory_order_release);
+
+        top_.best_bid = get_best_bid();
+        top_.best_ask = get_best_ask();
+        top_.last_trade = last_trade_price_;
+        top_.bid_levels = capture_top_levels(OrderSide::BID, top_.bids);
+        top_.ask_levels = capture_top_levels(OrderSide::ASK, top_.asks);
+
+        top_seq_.store(seq + 2, std::memory_order_release); // Even: write complete
+    }
+
+    // Helper: Capture the best BookTop::DEPTH levels of one side. The k
+    // best elements of a binary heap all sit within its first 2^k - 1
+    // slots, so the scan is bounded no matter how deep the book is.
+    std::size_t capture_top_levels(OrderSide side, std::pair<Price, Quantity>* out) noexcept
+    {
+        constexpr std::size_t WINDOW = (std::size_t(1) << BookTop::DEPTH) - 1;
+        const bool is_bid = (side == OrderSide::BID);
+
+        // Collect the candidate window off the book's heap array
+        Tick candidates[WINDOW];
+        std::size_t n = 0;
+        if (is_bid)
+        {
+            const std::size_t limit = std::min<std::size_t>(bid_book_.size(), WINDOW);
+            for (; n < limit; ++n)
+                candidates[n] = bid_book_.peek(static_cast<int>(n));
+        }
+        else
+        {
+            const std::size_t limit = std::min<std::size_t>(ask_book_.size(), WINDOW);
+            for (; n < limit; ++n)
+                candidates[n] = ask_book_.peek(static_cast<int>(n));
+        }
+
+        // Partial selection sort: move the best tick of the remainder to
+        // the front, emit it, repeat - DEPTH passes over <= WINDOW ticks
+        const std::size_t depth = std::min<std::size_t>(n, BookTop::DEPTH);
+        for (std::size_t k = 0; k < depth; ++k)
+        {
+            std::size_t best = k;
+            for (std::size_t i = k + 1; i < n; ++i)
+            {
+                if (is_bid ? (candidates[i] > candidates[best])
+                           : (candidates[i] < candidates[best]))
+                    best = i;
+            }
+            std::swap(candidates[k], candidates[best]);
+            const OrderLevel& level = is_bid ? bid_levels_[candidates[k]] : ask_levels_[candidates[k]];
+            out[k] = { to_price(candidates[k]), level.total_qty() };
+        }
+        return depth;
+    }
+
+    // Helper: Record an event in the binary journal. One branch, one struct
+    // copy and a release store when attached; a single branch when not.
+    void journal_event(EventKind kind, OrderId id, Quantity qty) noexcept
+    {
+        if (!journal_ring_ && !bus_ring_)
+            return;
+        const OrderInfo& order = order_pool_[id]; // Cold: seq/side/type
+        JournalEvent event{};
+        event.seq = order.seq_;
+        event.price = hot_pool_[id].price_;
+        event.qty = qty;
+        event.order_id = id;
+        event.kind = static_cast<std::uint8_t>(kind);
+        event.side = static_cast<std::uint8_t>(order.side_);
+        event.type = static_cast<std::uint8_t>(order.type_);
+        if (journal_ring_)
+        {
+            event.ticker_id = journal_ticker_id_;
+            journal_ring_->try_push(event);
+        }
+        if (bus_ring_)
+        {
+            event.ticker_id = bus_ticker_id_;
+            bus_ring_->try_push(event);
+        }
+    }
+
+    // Helper: Update order status and relink the per-status index
     void update_order_status(OrderId id, OrderStatus new_status) noexcept
     {
         if (id >= next_order_id_)
             return;
-        OrderInfo& order = order_pool_[id];
-        order.status_ = new_status;
+        const OrderStatus old_status = hot_pool_[id].status_;
+        if (old_status == new_status)
+            return;
+        status_unlink(id, old_status);
+        hot_pool_[id].status_ = new_status;
+        status_link(id, new_status);
+    }
+
+    // Helper: Push an order onto the front of its status list
+    void status_link(OrderId id, OrderStatus status) noexcept
+    {
+        StatusIndex& index = status_index_[static_cast<std::size_t>(status)];
+        OrderInfo& cold = order_pool_[id];
+        cold.status_prev_ = NULL_ORDER;
+        cold.status_next_ = index.head;
+        if (index.head != NULL_ORDER)
+            order_pool_[index.head].status_prev_ = id;
+        index.head = id;
+        ++index.count;
+    }
+
+    // Helper: Unlink an order from anywhere in its status list
+    void status_unlink(OrderId id, OrderStatus status) noexcept
+    {
+        StatusIndex& index = status_index_[static_cast<std::size_t>(status)];
+        OrderInfo& cold = order_pool_[id];
+        if (cold.status_prev_ != NULL_ORDER)
+            order_pool_[cold.status_prev_].status_next_ = cold.status_next_;
+        else
+            index.head = cold.status_next_;
+        if (cold.status_next_ != NULL_ORDER)
+            order_pool_[cold.status_next_].status_prev_ = cold.status_prev_;
+        cold.status_prev_ = NULL_ORDER;
+        cold.status_next_ = NULL_ORDER;
+        --index.count;
+    }
+
+    // Helper: File a stop order into its trigger ladder (off-book)
+    void place_stop(OrderId id, OrderSide side, OrderHot& order) noexcept
+    {
+        const Tick trigger = order.tick_;
+        if (side == OrderSide::ASK)
+        {
+            if (stop_ask_book_.find(trigger) == -1)
+            {
+                stop_ask_book_.push(trigger);
+                stop_ask_levels_[trigger] = OrderLevel();
+            }
+            stop_ask_levels_[trigger].append(hot_pool_, id);
+        }
+        else
+        {
+            if (stop_bid_book_.find(trigger) == -1)
+            {
+                stop_bid_book_.push(trigger);
+                stop_bid_levels_[trigger] = OrderLevel();
+            }
+            stop_bid_levels_[trigger].append(hot_pool_, id);
+        }
+
+        counters_.orders_placed.fetch_add(1, std::memory_order_relaxed);
+        journal_event(EventKind::Open, id, order.qty_);
+        if (verbose_on())
+            notify_open(id);
+    }
+
+    // Helper: Cancel a stop still waiting in its trigger ladder
+    bool cancel_stop(OrderId id, OrderHot& order, OrderSide side) noexcept
+    {
+        auto& ladder_levels = (side == OrderSide::ASK) ? stop_ask_levels_ : stop_bid_levels_;
+        OrderLevel& level = ladder_levels[order.tick_];
+        level.unlink(hot_pool_, id);
+        if (level.empty())
+        {
+            if (side == OrderSide::ASK)
+            {
+                const auto& slot = stop_ask_book_.find(order.tick_);
+                if (slot != -1)
+                    stop_ask_book_.pop(slot);
+            }
+            else
+            {
+                const auto& slot = stop_bid_book_.find(order.tick_);
+                if (slot != -1)
+                    stop_bid_book_.pop(slot);
+            }
+            ladder_levels.erase(order.tick_);
+        }
+
+        update_order_status(id, OrderStatus::CANCELLED);
+        counters_.orders_cancelled.fetch_add(1, std::memory_order_relaxed);
+        journal_event(EventKind::Cancel, id, order.qty_);
+        if (verbose_on())
+            notify_cancel(id);
+        return true; // Off-book: the published top never saw it
+    }
+
+    // Helper: Release every stop whose trigger the last trade satisfied.
+    // Ladder peeks keep the no-stops and no-trigger cases to one compare;
+    // each release may trade and reach further triggers, so loop to a
+    // fixed point.
+    void trigger_stops() noexcept
+    {
+        while (last_trade_price_ >= 0 &&
+               (!stop_ask_book_.empty() || !stop_bid_book_.empty()))
+        {
+            const Tick last = to_ticks(last_trade_price_);
+            OrderId id;
+            if (!stop_ask_book_.empty() && last <= stop_ask_book_.peek())
+                id = take_stop(OrderSide::ASK); // Price fell to a sell trigger
+            else if (!stop_bid_book_.empty() && last >= stop_bid_book_.peek())
+                id = take_stop(OrderSide::BID); // Price rose to a buy trigger
+            else
+                return;
+            release_stop(id);
+        }
+    }
+
+    // Helper: Pop the next stop off a ladder (oldest at the best trigger)
+    OrderId take_stop(OrderSide side) noexcept
+    {
+        auto& ladder_levels = (side == OrderSide::ASK) ? stop_ask_levels_ : stop_bid_levels_;
+        const Tick trigger = (side == OrderSide::ASK) ? stop_ask_book_.peek() : stop_bid_book_.peek();
+        OrderLevel& level = ladder_levels[trigger];
+        const OrderId id = level.front();
+        level.pop_front(hot_pool_);
+        if (level.empty())
+        {
+            if (side == OrderSide::ASK)
+                stop_ask_book_.pop();
+            else
+                stop_bid_book_.pop();
+            ladder_levels.erase(trigger);
+        }
+        return id;
+    }
+
+    // Helper: Execute a triggered stop as a market order - best opposing
+    // tick, into the book, matched immediately
+    void release_stop(OrderId id) noexcept
+    {
+        OrderHot& order = hot_pool_[id];
+        OrderInfo& cold = order_pool_[id];
+        cold.type_ = OrderType::MARKET; // A released stop is a market order from here on
+
+        // No opposing liquidity: reject, exactly like a market order
+        if ((cold.side_ == OrderSide::ASK && bid_book_.empty()) ||
+            (cold.side_ == OrderSide::BID && ask_book_.empty()))
+        {
+            update_order_status(id, OrderStatus::REJECTED);
+            counters_.orders_rejected.fetch_add(1, std::memory_order_relaxed);
+            journal_event(EventKind::Reject, id, order.qty_);
+            if (verbose_on())
+                notify_reject(id, "STOP TRIGGERED: NO MARKET LIQUIDITY");
+            return;
+        }
+
+        order.tick_ = cold.side_ == OrderSide::ASK ? bid_book_.peek() : ask_book_.peek();
+        order.price_ = to_price(order.tick_);
+
+        auto& levels = (cold.side_ == OrderSide::ASK) ? ask_levels_ : bid_levels_;
+        if (cold.side_ == OrderSide::ASK)
+        {
+            if (ask_book_.find(order.tick_) == -1)
+                ask_book_.push(order.tick_);
+        }
+        else
+        {
+            if (bid_book_.find(order.tick_) == -1)
+                bid_book_.push(order.tick_);
+        }
+        levels[order.tick_].append(hot_pool_, id);
+
+        journal_event(EventKind::Modify, id, order.qty_); // Stop released into the book
+        if (verbose_on())
+            notify_modify(id);
+        recent_order_id_ = id;
+        matching_engine();
+        publish_top();
+    }
+
+    // Helper: Re-arm a fully consumed iceberg slice from its hidden
+    // reserve. Happens in place at fill time - the order keeps its id and
+    // slot, and just rotates to the back of its level (a refreshed slice
+    // loses time priority). Returns true if the order lives on.
+    bool try_refill_iceberg(OrderId id, OrderHot& order, OrderLevel& level) noexcept
+    {
+        if (iceberg_state_.empty())
+            return false; // No icebergs anywhere - keep the fill path at one branch
+        auto it = iceberg_state_.find(id);
+        if (it == iceberg_state_.end())
+            return false;
+
+        const Quantity slice = std::min(it->second.display_, it->second.hidden_);
+        it->second.hidden_ -= slice;
+        level.unlink(hot_pool_, id); // qty_ is 0 here, so the aggregate is untouched
+        order.qty_ = slice;
+        level.append(hot_pool_, id); // Back of the queue
+        if (it->second.hidden_ <= 0)
+            iceberg_state_.erase(it); // Reserve exhausted - now a plain slice
+        return true;
     }
 
     // Matching Engine
@@ -411,67 +1486,99 @@ private:
         if (ask_book_.empty() || bid_book_.empty())
             return;  // Need both sides to match
         
-        OrderInfo& recent_order = order_pool_[recent_order_id_];
+        OrderHot& recent_order = hot_pool_[recent_order_id_];
+        const OrderSide recent_side = order_pool_[recent_order_id_].side_; // One cold read per call
         
         // Match loop
         while (recent_order.status_ == OrderStatus::OPEN && recent_order.qty_ > 0)
         {
-            // Get best prices ONCE per iteration
-            const Price best_ask_price = ask_book_.peek();
-            const Price best_bid_price = bid_book_.peek();
-            
+            counters_.match_iterations.fetch_add(1, std::memory_order_relaxed);
+
+            // Get best ticks ONCE per iteration
+            const Tick best_ask_tick = ask_book_.peek();
+            const Tick best_bid_tick = bid_book_.peek();
+
             // Check if trade is possible (early exit before any lookups)
-            const bool can_trade = (recent_order.side_ == OrderSide::ASK && best_bid_price >= recent_order.price_) ||
-                                   (recent_order.side_ == OrderSide::BID && best_ask_price <= recent_order.price_);
+            const bool can_trade = (recent_side == OrderSide::ASK && to_price(best_bid_tick) >= recent_order.price_) ||
+                                   (recent_side == OrderSide::BID && to_price(best_ask_tick) <= recent_order.price_);
             if (!can_trade)
                 break;  // No match possible
-            
-            // Get price levels ONCE (no redundant existence checks - if price is in book, level MUST exist)
-            OrderLevel& best_ask_level = ask_levels_[best_ask_price];
-            OrderLevel& best_bid_level = bid_levels_[best_bid_price];
-            
+
+            // Get price levels ONCE (no redundant existence checks - if tick is in book, level MUST exist)
+            OrderLevel& best_ask_level = ask_levels_[best_ask_tick];
+            OrderLevel& best_bid_level = bid_levels_[best_bid_tick];
+
             // Safety check
             if (best_ask_level.empty() || best_bid_level.empty())
                 break;
-            
+
             // Get order IDs from levels
-            const OrderId best_ask_id = best_ask_level.peek().second;
-            const OrderId best_bid_id = best_bid_level.peek().second;
-            
+            const OrderId best_ask_id = best_ask_level.front();
+            const OrderId best_bid_id = best_bid_level.front();
+
             // Match based on recent order side
-            if (recent_order.side_ == OrderSide::ASK)
-                matching(recent_order_id_, best_bid_id, best_ask_level, best_bid_level);
+            if (recent_side == OrderSide::ASK)
+                matching(recent_order_id_, best_bid_id, best_ask_level, best_bid_level, best_ask_tick, best_bid_tick);
             else
-                matching(best_ask_id, recent_order_id_, best_ask_level, best_bid_level);
+                matching(best_ask_id, recent_order_id_, best_ask_level, best_bid_level, best_ask_tick, best_bid_tick);
         }
     }
 
-    void matching(OrderId best_ask_id, OrderId best_bid_id, 
-                  OrderLevel& best_ask_level, OrderLevel& best_bid_level) noexcept
-    {   
+    void matching(OrderId best_ask_id, OrderId best_bid_id,
+                  OrderLevel& best_ask_level, OrderLevel& best_bid_level,
+                  Tick best_ask_tick, Tick best_bid_tick) noexcept
+    {
         
         // Get orders ONCE (use operator[] which is faster than at() for existing keys)
-        OrderInfo& best_ask = order_pool_[best_ask_id];
-        OrderInfo& best_bid = order_pool_[best_bid_id];
+        OrderHot& best_ask = hot_pool_[best_ask_id];
+        OrderHot& best_bid = hot_pool_[best_bid_id];
         // Calculate fill quantity
         const Quantity qty_filled = std::min(best_ask.qty_, best_bid.qty_);
         
-        // Update quantities
+        // Update quantities (and each level's running aggregate)
         best_ask.qty_ -= qty_filled;
         best_bid.qty_ -= qty_filled;
+        best_ask_level.reduce(qty_filled);
+        best_bid_level.reduce(qty_filled);
+
+        // Let the owner account for the fill (share balances etc.)
+        if (fill_hook_)
+        {
+            fill_hook_(fill_hook_ctx_, best_ask_id, OrderSide::ASK, qty_filled);
+            fill_hook_(fill_hook_ctx_, best_bid_id, OrderSide::BID, qty_filled);
+        }
         
         // Record trade
         last_trade_price_ = best_ask.price_;  // Use passive order price
-        
-        // Update statuses BEFORE notifications (so notifications see correct state)
-        if (best_ask.qty_ == 0)
+        const std::uint64_t trade_seq = counters_.trades.fetch_add(1, std::memory_order_relaxed) + 1;
+        counters_.trade_volume.store(
+            counters_.trade_volume.load(std::memory_order_relaxed) + qty_filled,
+            std::memory_order_relaxed);
+
+        // Feed the candle aggregator (one branch when no ring is attached)
+        if (trade_ring_)
+            trade_ring_->try_push(TradeTick{last_trade_price_, qty_filled, trade_seq});
+
+        // Update statuses BEFORE notifications (so notifications see correct
+        // state). A consumed iceberg slice refills in place instead of
+        // filling - the order stays OPEN with its next slice armed, and the
+        // journal below records a partial fill because qty_ is nonzero again.
+        if (best_ask.qty_ == 0 && !try_refill_iceberg(best_ask_id, best_ask, best_ask_level))
+        {
             update_order_status(best_ask_id, OrderStatus::FILLED);
-        
-        if (best_bid.qty_ == 0)
+            counters_.orders_matched.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (best_bid.qty_ == 0 && !try_refill_iceberg(best_bid_id, best_bid, best_bid_level))
+        {
             update_order_status(best_bid_id, OrderStatus::FILLED);
+            counters_.orders_matched.fetch_add(1, std::memory_order_relaxed);
+        }
     
-        // Submit notifications AFTER status updates
-        if (verbose_)
+        // Record fills AFTER status updates (journal first - it is the fill feed)
+        journal_event(best_ask.qty_ == 0 ? EventKind::Fill : EventKind::PartialFill, best_ask_id, qty_filled);
+        journal_event(best_bid.qty_ == 0 ? EventKind::Fill : EventKind::PartialFill, best_bid_id, qty_filled);
+        if (verbose_on())
         {
             notify_fill(best_ask_id, qty_filled);
             notify_fill(best_bid_id, qty_filled);
@@ -480,39 +1587,52 @@ private:
         // Clean up filled orders from book
         if (best_ask.qty_ == 0)
         {
-            best_ask_level.pop();
+            best_ask_level.pop_front(hot_pool_);
             if (best_ask_level.empty())
             {
                 ask_book_.pop();
-                ask_levels_.erase(best_ask.price_);
+                ask_levels_.erase(best_ask_tick);
             }
         }
 
         if (best_bid.qty_ == 0)
         {
-            best_bid_level.pop();
+            best_bid_level.pop_front(hot_pool_);
             if (best_bid_level.empty())
             {
                 bid_book_.pop();
-                bid_levels_.erase(best_bid.price_);
+                bid_levels_.erase(best_bid_tick);
             }
         }
     }
 
+    // Helper: Order type as a display string for notifications
+    static std::string type_name(OrderType type)
+    {
+        switch (type)
+        {
+            case OrderType::LIMIT:   return "LIMIT";
+            case OrderType::MARKET:  return "MARKET";
+            case OrderType::STOP:    return "STOP";
+            case OrderType::ICEBERG: return "ICEBERG";
+        }
+        return "UNKNOWN";
+    }
+
     // Notify of what Orders are open
     void notify_open(OrderId id)
     {
         if (id >= next_order_id_)
             throw std::runtime_error("Could Not Find Open Order");
 
-        OrderInfo& order = order_pool_[id];
+        const OrderInfo& order = *get_order(id);
         const std::string side = order.side_ == OrderSide::BID ? "BUY" : "SELL";
-        const std::string type = order.type_ == OrderType::LIMIT ? "LIMIT" : "MARKET";
+        const std::string type = type_name(order.type_);
         const std::string ticker_msg = "[" + ticker_ + "]";
 
         // Notification
         std::cout << ticker_msg << " | " << "[OPEN] | " << "TYPE: " << type << " | ID: " << id << " | SIDE: " << side << 
-        " | QTY: " << order.qty_ << " | PRICE: " << order.price_ << " | TIME: "  << order.time_ << std::endl;
+        " | QTY: " << order.qty_ << " | PRICE: " << order.price_ << " | SEQ: "  << order.seq_ << std::endl;
     }
 
     // Notify of what Orders were filled
@@ -521,9 +1641,9 @@ private:
         if (id >= next_order_id_)
             throw std::runtime_error("Could Not Find Filled Order");
 
-        OrderInfo& order = order_pool_[id];
+        const OrderInfo& order = *get_order(id);
         const std::string side = order.side_ == OrderSide::BID ? "BUY" : "SELL";
-        const std::string type = order.type_ == OrderType::LIMIT ? "LIMIT" : "MARKET";
+        const std::string type = type_name(order.type_);
         const std::string status = !order.qty_ ? "[FILLED]" : "[PARTIALLY FILLED]";
         const std::string ticker_msg = "[" + ticker_ + "]";
         const std::time_t current_time = std::time(0); // Time of Fill
@@ -539,9 +1659,9 @@ private:
         if (id >= next_order_id_)
             throw std::runtime_error("Could Not Find Cancelled Order");
 
-        OrderInfo& order = order_pool_[id];
+        const OrderInfo& order = *get_order(id);
         const std::string side = order.side_ == OrderSide::BID ? "BUY" : "SELL";
-        const std::string type = order.type_ == OrderType::LIMIT ? "LIMIT" : "MARKET";
+        const std::string type = type_name(order.type_);
         const std::string ticker_msg = "[" + ticker_ + "]";
         const std::time_t current_time = std::time(0); // Time of Cancel
         
@@ -556,9 +1676,9 @@ private:
         if (id >= next_order_id_)
             throw std::runtime_error("Could Not Find Rejected Order");
         
-        OrderInfo& order = order_pool_[id];
+        const OrderInfo& order = *get_order(id);
         const std::string side = order.side_ == OrderSide::BID ? "BUY" : "SELL";
-        const std::string type = order.type_ == OrderType::LIMIT ? "LIMIT" : "MARKET";
+        const std::string type = type_name(order.type_);
         const std::string reject_msg = "[REJECTED: " + err +  "]";
         const std::string ticker_msg = "[" + ticker_ + "]";
         const std::time_t current_time = std::time(0); // Time of Rejection
@@ -574,9 +1694,9 @@ private:
         if (id >= next_order_id_)
             throw std::runtime_error("Could Not Find Modified Order");
 
-        OrderInfo& order = order_pool_[id];
+        const OrderInfo& order = *get_order(id);
         const std::string side = order.side_ == OrderSide::BID ? "BUY" : "SELL";
-        const std::string type = order.type_ == OrderType::LIMIT ? "LIMIT" : "MARKET";
+        const std::string type = type_name(order.type_);
         const std::string ticker_msg = "[" + ticker_ + "]";
         const std::time_t current_time = std::time(0); // Time of Modification
         
@@ -584,4 +1704,12 @@ private:
         std::cout << ticker_msg << " | " << "[MODIFIED] | " << "TYPE: " << type << " | ID: " << id << " | SIDE: " << side << 
         " | QTY: " << order.qty_ << " | PRICE: " << order.price_ << " | TIME: "  << current_time << std::endl;
     }
-};
\ No newline at end of file
+};
+// Default engine: runtime verbose/auto_match flags - the historical
+// OrderEngine behavior, branch for branch.
+using OrderEngine = BasicOrderEngine<>;
+
+// Release/backtest engine: matching is unconditionally on and the
+// notification path is compiled out, so the hot loop carries no dead-flag
+// branches. Headless sweeps that never read the console run on this.
+using HeadlessOrderEngine = BasicOrderEngine<AlwaysMatch, SilentNotify>;
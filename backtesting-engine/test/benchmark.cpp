@@ -0,0 +1,305 @@
+#include "../engine_runtime.cpp"
+#include <iostream>
+#include <fstream>
+#include <random>
+#include <vector>
+#include <string>
+#include <chrono>
+
+// Benchmark harness. Measures engine and runtime throughput plus
+// per-operation latency percentiles and appends every result as a CSV row
+// so runs can be diffed across commits:
+//
+//   g++ -O2 -std=c++17 -pthread benchmark.cpp -o benchmark
+//   ./benchmark [runtime_workers] [csv_path]
+//
+// Defaults: 4 workers, benchmark_results.csv next to the binary.
+
+// Log-linear latency histogram (HDR style): 32 sub-buckets per power of
+// two gives ~3% relative error at any magnitude with a fixed 2048-slot
+// footprint and a branch-free record path - no allocation, no sort.
+class LatencyHistogram
+{
+public:
+    void record(std::uint64_t ns) noexcept
+    {
+        buckets_[bucket_index(ns)] += 1;
+        count_ += 1;
+    }
+
+    std::uint64_t count() const noexcept { return count_; }
+
+    // Value at the given percentile (0 < p <= 100)
+    std::uint64_t percentile(double p) const noexcept
+    {
+        if (count_ == 0)
+            return 0;
+        const std::uint64_t target = static_cast<std::uint64_t>(count_ * (p / 100.0) + 0.5);
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < NUM_BUCKETS; ++i)
+        {
+            seen += buckets_[i];
+            if (seen >= target)
+                return bucket_value(i);
+        }
+        return bucket_value(NUM_BUCKETS - 1);
+    }
+
+private:
+    static constexpr int SUB_BITS = 5; // 32 linear sub-buckets per octave
+    static constexpr std::size_t NUM_BUCKETS = 64 << SUB_BITS;
+
+    static std::size_t bucket_index(std::uint64_t v) noexcept
+    {
+        if (v < (1ull << SUB_BITS))
+            return static_cast<std::size_t>(v);
+        const int msb = 63 - __builtin_clzll(v);
+        const int shift = msb - SUB_BITS;
+        return ((static_cast<std::size_t>(shift) + 1) << SUB_BITS)
+             + static_cast<std::size_t>((v >> shift) & ((1ull << SUB_BITS) - 1));
+    }
+
+    static std::uint64_t bucket_value(std::size_t idx) noexcept
+    {
+        const std::size_t octave = idx >> SUB_BITS;
+        const std::uint64_t sub = idx & ((1ull << SUB_BITS) - 1);
+        if (octave == 0)
+            return sub;
+        return ((1ull << SUB_BITS) | sub) << (octave - 1);
+    }
+
+    std::uint64_t buckets_[NUM_BUCKETS] = {};
+    std::uint64_t count_ = 0;
+};
+
+// One CSV row per benchmark result; header written once per new file
+class CsvReporter
+{
+public:
+    explicit CsvReporter(const std::string& path)
+    {
+        std::ifstream probe(path);
+        const bool fresh = !probe.good() || probe.peek() == std::ifstream::traits_type::eof();
+        probe.close();
+
+        out_.open(path, std::ios::app);
+        if (fresh)
+            out_ << "benchmark,config,ops,millis,ops_per_sec,p50_ns,p99_ns,p999_ns\n";
+    }
+
+    void report(const std::string& benchmark, const std::string& config,
+                std::uint64_t ops, double millis, const LatencyHistogram& hist)
+    {
+        const double ops_per_sec = millis > 0.0 ? ops * 1000.0 / millis : 0.0;
+        out_ << benchmark << ',' << config << ',' << ops << ',' << millis << ','
+             << static_cast<std::uint64_t>(ops_per_sec) << ','
+             << hist.percentile(50.0) << ',' << hist.percentile(99.0) << ','
+             << hist.percentile(99.9) << '\n';
+        out_.flush();
+
+        std::cout << "  " << benchmark << " [" << config << "]: "
+                  << static_cast<std::uint64_t>(ops_per_sec) << " ops/sec"
+                  << " | p50 " << hist.percentile(50.0) << "ns"
+                  << " | p99 " << hist.percentile(99.0) << "ns"
+                  << " | p99.9 " << hist.percentile(99.9) << "ns" << std::endl;
+    }
+
+private:
+    std::ofstream out_;
+};
+
+static std::uint64_t now_ns() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+// Single-engine place/cancel throughput with a configurable operation mix.
+// matching=false quotes a wide two-sided book that never crosses (pure
+// insertion cost); matching=true crosses the spread constantly so the
+// matching loop dominates.
+static void bench_single_engine(CsvReporter& csv, const std::string& config,
+                                int pct_limit, int pct_market, bool matching)
+{
+    const std::size_t num_ops = 500000;
+    OrderEngine engine("BENCH", num_ops + 1, false);
+
+    std::mt19937 rng(42); // Fixed seed: identical op stream across commits
+    std::uniform_int_distribution<int> mix(0, 99);
+    std::uniform_int_distribution<int> tick(0, 99);
+
+    // Seed resting liquidity so market orders and cancels have a target
+    std::vector<OrderId> open_orders;
+    open_orders.reserve(1024);
+    for (int i = 0; i < 512; ++i)
+    {
+        engine.place_order(OrderSide::BID, OrderType::LIMIT, 95.0 - (i % 50) * 0.01, 10);
+        open_orders.push_back(engine.place_order(OrderSide::ASK, OrderType::LIMIT, 105.0 + (i % 50) * 0.01, 10));
+    }
+
+    LatencyHistogram hist;
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < num_ops; ++i)
+    {
+        const int roll = mix(rng);
+        const OrderSide side = (i & 1) ? OrderSide::BID : OrderSide::ASK;
+        const std::uint64_t t0 = now_ns();
+
+        if (roll < pct_limit)
+        {
+            // Crossing prices meet at 100; resting prices keep a wide spread
+            Price price;
+            if (matching)
+                price = 100.0;
+            else
+                price = (side == OrderSide::BID ? 90.0 : 110.0) + tick(rng) * 0.01;
+            OrderId id = engine.place_order(side, OrderType::LIMIT, price, 10);
+            if (!matching && id != static_cast<OrderId>(-1))
+                open_orders.push_back(id);
+        }
+        else if (roll < pct_limit + pct_market)
+        {
+            engine.place_order(side, OrderType::MARKET, -1, 1);
+        }
+        else if (!open_orders.empty())
+        {
+            engine.cancel_order(open_orders.back());
+            open_orders.pop_back();
+        }
+
+        hist.record(now_ns() - t0);
+    }
+
+    const auto end = std::chrono::high_resolution_clock::now();
+    const double millis = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+    csv.report("single_engine", config, num_ops, millis, hist);
+}
+
+// Scheduler-level scaling: same total order stream spread over more
+// workers and engines. Uses JobScheduler directly because the runtime is
+// a singleton and its worker count is fixed for the process lifetime.
+static void bench_scheduler_scaling(CsvReporter& csv, std::size_t num_workers)
+{
+    const std::size_t num_orders = 400000;
+    const std::size_t num_engines = num_workers * 4;
+    const std::size_t batch_size = 10000;
+
+    JobScheduler scheduler(num_workers, batch_size);
+    std::vector<std::unique_ptr<OrderEngine>> engines;
+    for (std::size_t e = 0; e < num_engines; ++e)
+        engines.push_back(std::make_unique<OrderEngine>("E" + std::to_string(e), num_orders / num_engines + 1, false));
+
+    std::vector<OrderId> results(num_orders, -1);
+    LatencyHistogram hist;
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < num_orders; ++i)
+    {
+        const std::size_t e = i % num_engines;
+        OrderJobArgs args{engines[e].get(), OrderSide::BID, OrderType::LIMIT,
+                          100.0 + (i % 100) * 0.01, 1, 0, &results[i], nullptr, nullptr, nullptr};
+        const std::uint64_t t0 = now_ns();
+        scheduler.submit_job(Job(JobOp::PlaceLimit, args, e), static_cast<WorkerId>(e % num_workers));
+        hist.record(now_ns() - t0);
+
+        if ((i + 1) % batch_size == 0)
+            scheduler.process_jobs();
+    }
+    scheduler.process_jobs();
+
+    const auto end = std::chrono::high_resolution_clock::now();
+    const double millis = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+    csv.report("scheduler_scaling", std::to_string(num_workers) + "_workers", num_orders, millis, hist);
+}
+
+// End-to-end runtime path at the worker count given on the command line:
+// ticker lookup skipped (interned id), ownership check, job build, submit,
+// auto-batching. The histogram captures submit-side latency; throughput
+// includes batch execution.
+static void bench_runtime_end_to_end(CsvReporter& csv, std::size_t num_workers)
+{
+    const std::size_t num_orders = 500000;
+    const std::size_t batch_size = 10000;
+
+    auto& runtime = EngineRuntime::get_instance(num_workers, num_orders, num_orders, false, true);
+    runtime.register_stock("SPY", 400.0, num_orders, num_orders);
+    const TickerId spy = runtime.get_ticker_id("SPY");
+
+    std::vector<OrderId> results(num_orders, -1);
+    LatencyHistogram hist;
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < num_orders; ++i)
+    {
+        const std::uint64_t t0 = now_ns();
+        runtime.limit_order(spy, OrderSide::BID, 390.0 + (i % 100) * 0.1, 1, &results[i]);
+        hist.record(now_ns() - t0);
+
+        if ((i + 1) % batch_size == 0)
+            runtime.execute_batch();
+    }
+    runtime.execute_batch();
+
+    const auto end = std::chrono::high_resolution_clock::now();
+    const double millis = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+    csv.report("runtime_end_to_end", std::to_string(num_workers) + "_workers", num_orders, millis, hist);
+
+    runtime.reset();
+}
+
+// Same end-to-end path through an inline runtime (num_threads == 0):
+// every order runs place_order on the caller's thread, so the histogram
+// captures the full submit-to-matched latency
+static void bench_inline_end_to_end(CsvReporter& csv)
+{
+    const std::size_t num_orders = 500000;
+
+    EngineRuntime runtime(0, num_orders, num_orders, false, true);
+    runtime.register_stock("SPY", 400.0, num_orders, num_orders);
+    const TickerId spy = runtime.get_ticker_id("SPY");
+
+    std::vector<OrderId> results(num_orders, -1);
+    LatencyHistogram hist;
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    for (std::size_t i = 0; i < num_orders; ++i)
+    {
+        const std::uint64_t t0 = now_ns();
+        runtime.limit_order(spy, OrderSide::BID, 390.0 + (i % 100) * 0.1, 1, &results[i]);
+        hist.record(now_ns() - t0);
+    }
+
+    const auto end = std::chrono::high_resolution_clock::now();
+    const double millis = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.0;
+    csv.report("runtime_end_to_end", "inline", num_orders, millis, hist);
+}
+
+int main(int argc, char* argv[])
+{
+    const std::size_t runtime_workers = argc > 1 ? std::stoul(argv[1]) : 4;
+    const std::string csv_path = argc > 2 ? argv[2] : "benchmark_results.csv";
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "  Titan Benchmark Suite" << std::endl;
+    std::cout << "  Results appended to " << csv_path << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    CsvReporter csv(csv_path);
+
+    std::cout << "\n--- Single Engine ---" << std::endl;
+    bench_single_engine(csv, "limit_resting", 100, 0, false);
+    bench_single_engine(csv, "limit_matching", 100, 0, true);
+    bench_single_engine(csv, "mixed_70l_20m_10c", 70, 20, false);
+
+    std::cout << "\n--- Scheduler Scaling ---" << std::endl;
+    for (std::size_t workers : {1, 2, 4, 8, 16})
+        bench_scheduler_scaling(csv, workers);
+
+    std::cout << "\n--- Runtime End-to-End ---" << std::endl;
+    bench_runtime_end_to_end(csv, runtime_workers);
+    bench_inline_end_to_end(csv);
+
+    std::cout << "\nBenchmark suite complete" << std::endl;
+    return 0;
+}
@@ -193,17 +193,300 @@ void test_order_priority()
     assert(engine.get_order(bid2) != nullptr && "Order 2 should exist");
     assert(engine.get_order(bid3) != nullptr && "Order 3 should exist");
     
-    // Orders should have different timestamps
+    // Orders should have strictly increasing sequence numbers
     const OrderInfo* o1 = engine.get_order(bid1);
     const OrderInfo* o2 = engine.get_order(bid2);
     const OrderInfo* o3 = engine.get_order(bid3);
-    
-    assert(o1->time_ <= o2->time_ && "Order 1 time should be <= Order 2 time");
-    assert(o2->time_ <= o3->time_ && "Order 2 time should be <= Order 3 time");
+
+    assert(o1->seq_ < o2->seq_ && "Order 1 seq should be < Order 2 seq");
+    assert(o2->seq_ < o3->seq_ && "Order 2 seq should be < Order 3 seq");
     
     std::cout << "✓ Order Priority test PASSED!\n\n";
 }
 
+void test_pool_growth()
+{
+    std::cout << "=== Testing Order Pool Growth ===\n";
+
+    // Capacity hint of 64 but 1000 orders: the chunked arena grows by
+    // whole blocks, so earlier orders keep their ids and addresses
+    OrderEngine engine("GROW", 64, VERBOSE, false);
+
+    std::vector<OrderId> ids;
+    for (int i = 0; i < 1000; ++i)
+    {
+        OrderId id = engine.place_order(OrderSide::BID, OrderType::LIMIT, 50.0 + (i % 20) * 0.05, 5);
+        assert(id != static_cast<OrderId>(-1) && "Placement past the capacity hint should grow, not fail");
+        ids.push_back(id);
+    }
+
+    const OrderInfo* first = engine.get_order(ids.front());
+    assert(first != nullptr && first->status_ == OrderStatus::OPEN);
+    assert(first->qty_ == 5 && "Order placed before growth must survive it");
+    assert(engine.cancel_order(ids.front()) && "Pre-growth order still cancellable");
+
+    std::cout << "✓ Order Pool Growth test PASSED!\n\n";
+}
+
+void test_top_of_book()
+{
+    std::cout << "=== Testing Top-of-Book Snapshot ===\n";
+
+    OrderEngine engine("SNAP", 128, VERBOSE, false);
+
+    // Two bid levels and one ask level
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 99.0, 10);
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 98.0, 20);
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 98.0, 5);
+    OrderId ask = engine.place_order(OrderSide::ASK, OrderType::LIMIT, 101.0, 15);
+
+    BookTop top = engine.get_top_of_book();
+    assert(top.best_bid == engine.get_best_bid());
+    assert(top.best_ask == engine.get_best_ask());
+    assert(top.bid_levels == 2 && top.ask_levels == 1);
+    assert(top.bids[0].first == 99.0 && top.bids[0].second == 10);
+    assert(top.bids[1].first == 98.0 && top.bids[1].second == 25);
+    assert(top.asks[0].first == 101.0 && top.asks[0].second == 15);
+
+    // Snapshot follows a cancel
+    assert(engine.cancel_order(ask));
+    top = engine.get_top_of_book();
+    assert(top.ask_levels == 0 && top.best_ask == -1);
+
+    std::cout << "✓ Top-of-Book Snapshot test PASSED!\n\n";
+}
+
+void test_stop_orders()
+{
+    std::cout << "=== Testing Stop Orders ===\n";
+
+    OrderEngine engine("STOP", 10000, VERBOSE);
+
+    // Trade once to establish a last trade price of 100
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 100.0, 10);
+    engine.place_order(OrderSide::ASK, OrderType::LIMIT, 100.0, 10);
+    assert(engine.get_market_price() == 100.0 && "Last trade should be 100");
+
+    // Sell stop below the market waits in the ladder, off the book
+    auto stop1 = engine.place_order(OrderSide::ASK, OrderType::STOP, 95.0, 5);
+    assert(stop1 != static_cast<OrderId>(-1) && "Stop should be accepted");
+    assert(engine.get_order(stop1)->status_ == OrderStatus::OPEN && "Waiting stop is OPEN");
+    assert(engine.get_pending_stop_count() == 1 && "Stop should be pending");
+    assert(engine.get_level_count(OrderSide::ASK) == 0 && "Waiting stop must not rest in the book");
+
+    // A waiting stop can be cancelled
+    auto stop2 = engine.place_order(OrderSide::ASK, OrderType::STOP, 94.0, 5);
+    assert(engine.get_pending_stop_count() == 2);
+    assert(engine.cancel_order(stop2) && "Waiting stop should cancel");
+    assert(engine.get_order(stop2)->status_ == OrderStatus::CANCELLED);
+    assert(engine.get_pending_stop_count() == 1 && "Cancelled stop leaves the ladder");
+
+    // Drive the price down to the trigger: the stop releases as a market
+    // order and sells into the remaining bids
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 95.0, 5);
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 94.0, 20);
+    engine.place_order(OrderSide::ASK, OrderType::LIMIT, 95.0, 5); // Trades at 95
+    assert(engine.get_pending_stop_count() == 0 && "Trigger reached - ladder empty");
+    assert(engine.get_order(stop1)->status_ == OrderStatus::FILLED && "Triggered stop should fill");
+    assert(engine.get_order(stop1)->qty_ == 0);
+
+    // Buy stop above the market: waits, then releases as the price rises
+    auto stop3 = engine.place_order(OrderSide::BID, OrderType::STOP, 96.0, 5);
+    assert(engine.get_pending_stop_count() == 1 && "Buy stop should wait below its trigger");
+    engine.place_order(OrderSide::ASK, OrderType::LIMIT, 96.0, 10);
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 96.0, 5); // Trades at 96
+    assert(engine.get_pending_stop_count() == 0 && "Rising price releases the buy stop");
+    assert(engine.get_order(stop3)->status_ == OrderStatus::FILLED && "Released buy stop should fill");
+
+    // A stop whose trigger the market already passed releases immediately
+    auto stop4 = engine.place_order(OrderSide::ASK, OrderType::STOP, 98.0, 5);
+    assert(engine.get_pending_stop_count() == 0 && "Already-triggered stop never waits");
+    assert(engine.get_order(stop4)->status_ == OrderStatus::FILLED && "Immediate release should fill");
+
+    // A triggered stop with no opposing liquidity is rejected like a market order
+    OrderEngine engine2("STOP2", 10000, VERBOSE);
+    engine2.place_order(OrderSide::BID, OrderType::LIMIT, 100.0, 5);
+    engine2.place_order(OrderSide::ASK, OrderType::LIMIT, 100.0, 5); // Trade empties both books
+    auto stop5 = engine2.place_order(OrderSide::ASK, OrderType::STOP, 100.0, 5);
+    assert(engine2.get_order(stop5)->status_ == OrderStatus::REJECTED && "No liquidity - rejected");
+
+    std::cout << "✓ Stop Orders test PASSED!\n\n";
+}
+
+void test_iceberg_orders()
+{
+    std::cout << "=== Testing Iceberg Orders ===\n";
+
+    OrderEngine engine("BERG", 10000, VERBOSE);
+
+    // Total 100, display 10: only the slice rests in the book
+    auto berg = engine.place_order(OrderSide::ASK, OrderType::ICEBERG, 50.0, 100, 10);
+    assert(berg != static_cast<OrderId>(-1) && "Iceberg should be accepted");
+    assert(engine.get_order(berg)->qty_ == 10 && "Only the display slice rests");
+    assert(engine.get_hidden_qty(berg) == 90 && "Remainder hides in the reserve");
+    auto depth = engine.get_market_depth(OrderSide::ASK, 5);
+    assert(depth[0].second == 10 && "Depth shows the display slice only");
+
+    // Consuming a full slice refills it in place - same id, still OPEN
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 50.0, 10);
+    assert(engine.get_order(berg)->status_ == OrderStatus::OPEN && "Refilled iceberg stays open");
+    assert(engine.get_order(berg)->qty_ == 10 && "Next slice armed");
+    assert(engine.get_hidden_qty(berg) == 80 && "Reserve drained by one slice");
+
+    // A partial slice fill does not touch the reserve
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 50.0, 4);
+    assert(engine.get_order(berg)->qty_ == 6 && "Partial fill reduces the slice");
+    assert(engine.get_hidden_qty(berg) == 80 && "Reserve untouched on partial fills");
+
+    // One large aggressor walks through several refills in one match loop
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 50.0, 30);
+    assert(engine.get_order(berg)->qty_ == 6 && "6 + 10 + 10 + 4 consumed");
+    assert(engine.get_hidden_qty(berg) == 50 && "Three refills drained the reserve");
+
+    // A refreshed slice loses time priority to orders behind it
+    auto plain = engine.place_order(OrderSide::ASK, OrderType::LIMIT, 50.0, 5);
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 50.0, 6); // Consumes the slice, iceberg rotates back
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 50.0, 5);
+    assert(engine.get_order(plain)->status_ == OrderStatus::FILLED && "Plain ask fills ahead of the refreshed slice");
+    assert(engine.get_order(berg)->qty_ == 10 && "Rotated slice untouched");
+    assert(engine.get_hidden_qty(berg) == 40);
+
+    // Cancel folds the reserve back so the record shows the full remainder
+    assert(engine.cancel_order(berg) && "Iceberg should cancel");
+    assert(engine.get_order(berg)->status_ == OrderStatus::CANCELLED);
+    assert(engine.get_order(berg)->qty_ == 50 && "Cancel reports slice + reserve");
+    assert(engine.get_hidden_qty(berg) == 0 && "Reserve released on cancel");
+
+    // Reserve exhaustion: the last slice fills the order for good
+    OrderEngine engine2("BERG2", 10000, VERBOSE);
+    auto berg2 = engine2.place_order(OrderSide::ASK, OrderType::ICEBERG, 51.0, 12, 5);
+    engine2.place_order(OrderSide::BID, OrderType::LIMIT, 51.0, 12);
+    assert(engine2.get_order(berg2)->status_ == OrderStatus::FILLED && "Exhausted iceberg fills");
+    assert(engine2.get_hidden_qty(berg2) == 0);
+
+    // Display of 0 (or >= total) degrades to a plain limit
+    auto plain2 = engine2.place_order(OrderSide::ASK, OrderType::ICEBERG, 51.0, 7, 0);
+    assert(engine2.get_order(plain2)->qty_ == 7 && "No display - full qty rests");
+    assert(engine2.get_hidden_qty(plain2) == 0 && "No reserve");
+
+    // Snapshot round-trip carries the ladder and the reserves (v2)
+    OrderEngine engine3("SNAP3", 10000, VERBOSE);
+    engine3.place_order(OrderSide::BID, OrderType::LIMIT, 60.0, 5);
+    engine3.place_order(OrderSide::ASK, OrderType::LIMIT, 60.0, 5); // Sets last trade
+    auto snap_stop = engine3.place_order(OrderSide::ASK, OrderType::STOP, 55.0, 5);
+    auto snap_berg = engine3.place_order(OrderSide::ASK, OrderType::ICEBERG, 61.0, 20, 4);
+    std::vector<unsigned char> image(engine3.snapshot_size());
+    assert(engine3.save_snapshot(image.data()) == image.size());
+    OrderEngine restored("SNAP3R", 10000, VERBOSE);
+    assert(restored.load_snapshot(image.data(), image.size()) == image.size());
+    assert(restored.get_pending_stop_count() == 1 && "Waiting stop survives the round trip");
+    assert(restored.get_order(snap_stop)->status_ == OrderStatus::OPEN);
+    assert(restored.get_hidden_qty(snap_berg) == 16 && "Reserve survives the round trip");
+    assert(restored.get_order(snap_berg)->qty_ == 4 && "Display slice survives the round trip");
+
+    std::cout << "✓ Iceberg Orders test PASSED!\n\n";
+}
+
+void test_fork_engine()
+{
+    std::cout << "=== Testing Copy-on-Write Fork ===\n";
+
+    OrderEngine parent("FORK", 10000, VERBOSE);
+    auto bid1 = parent.place_order(OrderSide::BID, OrderType::LIMIT, 100.0, 10);
+    auto bid2 = parent.place_order(OrderSide::BID, OrderType::LIMIT, 99.0, 20);
+    auto ask1 = parent.place_order(OrderSide::ASK, OrderType::LIMIT, 101.0, 10);
+    auto ask2 = parent.place_order(OrderSide::ASK, OrderType::LIMIT, 102.0, 5);
+    parent.place_order(OrderSide::BID, OrderType::LIMIT, 101.0, 4); // Trades 4 at 101
+    (void)bid1;
+
+    OrderEngine clone("FORK", 64, VERBOSE);
+    clone.fork_from(parent);
+
+    // The clone sees the parent's book exactly
+    assert(clone.get_best_bid() == 100.0 && clone.get_best_ask() == 101.0);
+    assert(clone.get_market_price() == 101.0);
+    assert(clone.get_order(ask1)->qty_ == 6 && "Partial fill carried into the fork");
+
+    // What-if on the clone: take out the ask side level by level (an
+    // aggressive limit pegs to the best opposing price at entry)
+    auto sweep1 = clone.place_order(OrderSide::BID, OrderType::LIMIT, 101.0, 6);
+    auto sweep2 = clone.place_order(OrderSide::BID, OrderType::LIMIT, 102.0, 5);
+    assert(clone.get_order(sweep1)->status_ == OrderStatus::FILLED);
+    assert(clone.get_order(sweep2)->status_ == OrderStatus::FILLED);
+    assert(clone.get_best_ask() == -1 && "Clone's asks are gone");
+    assert(clone.get_order(ask2)->status_ == OrderStatus::FILLED);
+
+    // The parent never saw any of it
+    assert(parent.get_best_ask() == 101.0 && "Parent book untouched by the fork");
+    assert(parent.get_order(ask1)->qty_ == 6);
+    assert(parent.get_order(ask1)->status_ == OrderStatus::OPEN);
+    assert(parent.get_order(ask2)->status_ == OrderStatus::OPEN);
+
+    // And parent writes don't reach the clone
+    assert(parent.cancel_order(bid2));
+    assert(clone.get_order(bid2)->status_ == OrderStatus::OPEN && "Fork isolated from parent writes");
+
+    // Fork cost scales with the block table, not the order count
+    const int NUM_ORDERS = 1000000;
+    OrderEngine big("BIG", NUM_ORDERS, false, false);
+    for (int i = 0; i < NUM_ORDERS; ++i)
+        big.place_order(OrderSide::BID, OrderType::LIMIT, 50.0 + (i % 100) * 0.01, 5);
+
+    auto fork_start = std::chrono::high_resolution_clock::now();
+    OrderEngine big_clone("BIG", 64, false, false);
+    big_clone.fork_from(big);
+    auto fork_end = std::chrono::high_resolution_clock::now();
+    auto fork_us = std::chrono::duration_cast<std::chrono::microseconds>(fork_end - fork_start).count();
+    std::cout << "Forked a " << NUM_ORDERS << "-order book in " << fork_us << " μs\n";
+
+    // Both sides keep working after the fork
+    assert(big_clone.place_order(OrderSide::BID, OrderType::LIMIT, 51.0, 5) != static_cast<OrderId>(-1));
+    assert(big.place_order(OrderSide::BID, OrderType::LIMIT, 51.0, 5) != static_cast<OrderId>(-1));
+    assert(big_clone.cancel_order(0) && big.get_order(0)->status_ == OrderStatus::OPEN);
+
+    std::cout << "✓ Copy-on-Write Fork test PASSED!\n\n";
+}
+
+void test_headless_engine()
+{
+    std::cout << "=== Testing Headless Engine Specialization ===\n";
+
+    // Fixed policies: matching unconditionally on, notifications compiled
+    // out. Matching behavior must be identical to the default engine.
+    HeadlessOrderEngine engine("AAPL", 1024);
+    assert(engine.get_auto_match());
+
+    OrderId ask = engine.place_order(OrderSide::ASK, OrderType::LIMIT, 100.0, 10);
+    OrderId bid = engine.place_order(OrderSide::BID, OrderType::LIMIT, 100.0, 4);
+    assert(engine.get_order(bid)->status_ == OrderStatus::FILLED);
+    assert(engine.get_order(ask)->status_ == OrderStatus::OPEN);
+    assert(engine.get_order(ask)->qty_ == 6);
+    assert(engine.get_market_price() == 100.0);
+
+    // Cancels and stops run through the same code paths
+    OrderId rest = engine.place_order(OrderSide::BID, OrderType::LIMIT, 99.0, 5);
+    assert(engine.cancel_order(rest));
+    OrderId stop = engine.place_order(OrderSide::ASK, OrderType::STOP, 99.5, 3);
+    assert(engine.get_pending_stop_count() == 1);
+
+    // Price falls through the trigger: the stop releases as a market
+    // order into the resting bid (matching is fixed on - no flag to set)
+    engine.place_order(OrderSide::BID, OrderType::LIMIT, 100.0, 6); // Clears the 6 left on the ask
+    OrderId deep_bid = engine.place_order(OrderSide::BID, OrderType::LIMIT, 99.0, 5);
+    engine.place_order(OrderSide::ASK, OrderType::LIMIT, 99.0, 2); // Trades at 99 - trigger reached
+    assert(engine.get_pending_stop_count() == 0);
+    assert(engine.get_order(stop)->status_ == OrderStatus::FILLED);
+    assert(engine.get_order(deep_bid)->status_ == OrderStatus::FILLED); // 2 from the ask + 3 from the stop
+
+    // Forks work on specialized engines too (same instantiation both sides)
+    HeadlessOrderEngine clone("AAPL", 1024);
+    clone.fork_from(engine);
+    assert(clone.get_best_ask() == engine.get_best_ask());
+    assert(clone.get_market_price() == engine.get_market_price());
+
+    std::cout << "✓ Headless Engine Specialization test PASSED!\n\n";
+}
+
 void test_stress_orders()
 {
     std::cout << "=== Stress Testing Order Operations ===\n";
@@ -495,6 +778,12 @@ int main()
     test_multiple_orders_same_price();
     test_order_priority();
     test_order_matching_correctness();
+    test_pool_growth();
+    test_top_of_book();
+    test_stop_orders();
+    test_iceberg_orders();
+    test_fork_engine();
+    test_headless_engine();
     test_stress_orders();
     std::cout << "========================================\n";
     std::cout << "  All Order Tests PASSED! ✓\n";
@@ -0,0 +1,132 @@
+#include "../market_replay.cpp"
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <chrono>
+
+void test_replay_round_trip()
+{
+    std::cout << "=== Test: Replay Round Trip ===" << std::endl;
+
+    const std::string csv_path = "/tmp/titan_replay_test.csv";
+    const std::string bin_path = "/tmp/titan_replay_test.bin";
+
+    // A small capture: a cross against the IPO ask, a resting bid, a
+    // cancel of that bid, and a market buy (row 4 cancels row 2)
+    {
+        std::ofstream csv(csv_path);
+        csv << "# ticker,op,side,price,qty,timestamp,user,target\n";
+        csv << "MSFT,L,B,300.0,10,1000,42\n";
+        csv << "MSFT,L,B,299.0,5,2000,42\n";
+        csv << "MSFT,L,B,298.0,5,3000,42\n";
+        csv << "MSFT,C,B,,,4000,42,1\n";
+        csv << "MSFT,M,B,,15,5000,42\n";
+        csv << "NOPE,L,B,1.0,1,6000,42\n"; // Unknown ticker - skipped
+    }
+    assert(convert_csv_capture(csv_path, bin_path) == 6);
+
+    // The binary file decodes back to what the CSV said
+    {
+        ReplayReader reader(bin_path);
+        assert(reader.size() == 6);
+        assert(reader.tickers().size() == 2);
+        assert(reader.tickers()[0] == "MSFT");
+        assert(static_cast<ReplayOp>(reader[0].op) == ReplayOp::PlaceLimit);
+        assert(reader[0].price == 300.0 && reader[0].qty == 10.0);
+        assert(reader[0].timestamp == 1000 && reader[0].user == 42);
+        assert(static_cast<ReplayOp>(reader[3].op) == ReplayOp::Cancel);
+        assert(reader[3].target == 1);
+        assert(static_cast<ReplayOp>(reader[4].op) == ReplayOp::PlaceMarket);
+    }
+
+    auto& runtime = EngineRuntime::get_instance(4, 10000, 0, false, true);
+    assert(runtime.register_stock("MSFT", 300.0, 1000));
+    TickerId msft = runtime.get_ticker_id("MSFT");
+
+    ReplayDriver driver(runtime);
+    ReplayDriver::ReplayStats stats;
+    assert(driver.replay(bin_path, &stats));
+    assert(stats.records == 6);
+    assert(stats.submitted == 5);
+    assert(stats.skipped == 1); // The unknown ticker
+
+    // 10 limit + 15 market bought off the IPO ask, the 299 bid cancelled
+    EngineStats after = runtime.get_stats(msft);
+    assert(after.trades == 2);
+    assert(after.trade_volume == 25.0);
+    assert(after.orders_cancelled == 1);
+    assert(runtime.has_sufficient_shares(IPO_HOLDER, msft, 975.0));
+    assert(!runtime.has_sufficient_shares(IPO_HOLDER, msft, 976.0));
+
+    auto bids = runtime.get_market_depth("MSFT", OrderSide::BID, 4);
+    assert(bids.size() == 1);
+    assert(bids[0].first == 298.0 && bids[0].second == 5.0);
+
+    std::remove(csv_path.c_str());
+    std::remove(bin_path.c_str());
+    std::cout << "Replay round trip test passed" << std::endl;
+
+    runtime.reset();
+}
+
+void test_replay_throughput()
+{
+    std::cout << "\n=== Test: Replay Throughput ===" << std::endl;
+
+    const std::string bin_path = "/tmp/titan_replay_perf.bin";
+    const std::size_t num_orders = 500000;
+
+    // Write the capture directly - resting bids walking down the book
+    {
+        ReplayWriter writer(bin_path);
+        const std::uint32_t btc = writer.intern_ticker("BTC");
+        for (std::size_t i = 0; i < num_orders; ++i)
+        {
+            ReplayRecord record{};
+            record.timestamp = i;
+            record.ticker = btc;
+            record.user = 1;
+            record.price = 40000.0 - (i % 1000) * 0.5;
+            record.qty = 1.0;
+            record.op = static_cast<std::uint8_t>(ReplayOp::PlaceLimit);
+            record.side = static_cast<std::uint8_t>(OrderSide::BID);
+            writer.append(record);
+        }
+    }
+
+    auto& runtime = EngineRuntime::get_instance(4, 100000, num_orders + 16, false, true);
+    assert(runtime.register_stock("BTC", 50000.0, 1000, num_orders + 16));
+
+    ReplayDriver driver(runtime);
+    ReplayDriver::ReplayStats stats;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    assert(driver.replay(bin_path, &stats));
+    auto end = std::chrono::high_resolution_clock::now();
+
+    assert(stats.submitted == num_orders);
+    assert(stats.skipped == 0);
+    assert(runtime.get_stats("BTC").orders_placed == num_orders + 1); // + IPO seed
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    std::cout << "Replayed " << num_orders << " records in " << ms << "ms ("
+              << (ms > 0 ? num_orders * 1000 / ms : 0) << " records/sec)" << std::endl;
+    std::cout << "Replay throughput test passed" << std::endl;
+
+    std::remove(bin_path.c_str());
+    runtime.reset();
+}
+
+int main()
+{
+    std::cout << "========================================" << std::endl;
+    std::cout << "  Market Replay Tests" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    test_replay_round_trip();
+    test_replay_throughput();
+
+    std::cout << "\nAll replay tests passed!" << std::endl;
+    return 0;
+}
@@ -403,6 +403,398 @@ void test_monte_carlo_simulation()
     std::cout << "Monte Carlo simulation test passed" << std::endl;
 }
 
+void test_request_handles()
+{
+    std::cout << "\n=== Test: Request Handles (Futures) ===" << std::endl;
+
+    auto& runtime = EngineRuntime::get_instance(4, 10000, 0, false, true);
+
+    assert(runtime.register_stock("NVDA", 500.0, 1000));
+    TickerId nvda = runtime.get_ticker_id("NVDA");
+    assert(nvda != INVALID_TICKER);
+
+    // Submit through handles - no out-pointers to keep alive
+    auto h1 = runtime.submit_limit_order(nvda, OrderSide::BID, 495.0, 10);
+    auto h2 = runtime.submit_limit_order(nvda, OrderSide::BID, 490.0, 20);
+    assert(h1.valid() && h2.valid());
+
+    runtime.execute_batch();
+
+    assert(h1.ready() && h2.ready());
+    OrderId id1 = h1.get();
+    OrderId id2 = h2.get();
+    assert(id1 != static_cast<OrderId>(-1));
+    assert(id2 != static_cast<OrderId>(-1));
+    assert(h1.status() == RequestStatus::Completed);
+
+    // Cancel through a handle and wait on the typed result
+    auto hc = runtime.submit_cancel_order(nvda, id2);
+    runtime.execute_batch();
+    assert(hc.get() == true);
+
+    // A rejected request still completes (as Failed) so wait() cannot hang
+    auto bad = runtime.submit_limit_order(nvda, OrderSide::BID, -1.0, 10);
+    assert(bad.valid());
+    bad.wait();
+    assert(bad.status() == RequestStatus::Failed);
+    assert(bad.get() == static_cast<OrderId>(-1));
+
+    std::cout << "Request handles test passed" << std::endl;
+
+    EngineRuntime::get_instance().reset();
+}
+
+void test_engine_stats()
+{
+    std::cout << "\n=== Test: Engine Stats ===" << std::endl;
+
+    auto& runtime = EngineRuntime::get_instance(4, 10000, 0, false, true);
+
+    assert(runtime.register_stock("INTC", 30.0, 1000));
+    TickerId intc = runtime.get_ticker_id("INTC");
+
+    // One cross (two fills), one resting order, one cancel
+    OrderId ask_id = -1, bid_id = -1, rest_id = -1;
+    runtime.limit_order(intc, OrderSide::ASK, 29.0, 10, &ask_id, IPO_HOLDER);
+    runtime.limit_order(intc, OrderSide::BID, 29.0, 10, &bid_id);
+    runtime.limit_order(intc, OrderSide::BID, 28.0, 5, &rest_id);
+    runtime.execute_batch();
+    bool cancelled = false;
+    runtime.cancel_order(intc, rest_id, &cancelled, 1);
+    runtime.execute_batch();
+
+    EngineStats stats = runtime.get_stats(intc);
+    assert(stats.orders_placed == 4);       // IPO seed + the three above
+    assert(stats.orders_matched == 2);      // Both sides of the cross
+    assert(stats.orders_cancelled == 1);
+    assert(stats.trades == 1);
+    assert(stats.trade_volume == 10.0);
+    assert(stats.match_iterations >= 1);
+    assert(stats.open_orders == 1);         // Only the IPO ask still open
+    assert(stats.filled_orders == 2);       // Both sides of the cross
+    assert(stats.ask_levels == 1);          // IPO ask still resting
+    assert(stats.bid_levels == 0);
+    assert(stats.worker_stats.jobs_executed >= 4);
+    assert(stats.worker_stats.queue_high_water >= 1);
+
+    // Unknown tickers snapshot as zeroes instead of throwing out
+    assert(runtime.get_stats("NOPE").orders_placed == 0);
+
+    std::cout << "Placed " << stats.orders_placed << ", matched " << stats.orders_matched
+              << ", volume " << stats.trade_volume
+              << ", worker jobs " << stats.worker_stats.jobs_executed << std::endl;
+    std::cout << "Engine stats test passed" << std::endl;
+
+    EngineRuntime::get_instance().reset();
+}
+
+void test_share_balances()
+{
+    std::cout << "\n=== Test: Share Balance Accounting ===" << std::endl;
+
+    auto& runtime = EngineRuntime::get_instance(4, 10000, 0, false, true);
+
+    assert(runtime.register_stock("NVDA", 500.0, 100));
+    TickerId nvda = runtime.get_ticker_id("NVDA");
+
+    // The IPO holder owns the float; a fresh user owns nothing
+    assert(runtime.has_sufficient_shares(IPO_HOLDER, nvda, 100.0));
+    assert(!runtime.has_sufficient_shares(IPO_HOLDER, nvda, 101.0));
+    assert(!runtime.has_sufficient_shares(42, nvda, 1.0));
+
+    // A user with no shares cannot sell
+    OrderId ask_id = -1;
+    runtime.limit_order(nvda, OrderSide::ASK, 510.0, 5, &ask_id, 42);
+    runtime.execute_batch();
+    assert(ask_id == static_cast<OrderId>(-1));
+
+    // A bid lifts 40 shares off the IPO ask - the balance follows the fill
+    OrderId bid_id = -1;
+    runtime.limit_order(nvda, OrderSide::BID, 500.0, 40, &bid_id, 42);
+    runtime.execute_batch();
+    assert(bid_id != static_cast<OrderId>(-1));
+    assert(runtime.has_sufficient_shares(IPO_HOLDER, nvda, 60.0));
+    assert(!runtime.has_sufficient_shares(IPO_HOLDER, nvda, 61.0));
+
+    std::cout << "Share balance accounting test passed" << std::endl;
+
+    runtime.reset();
+}
+
+void test_submit_orders()
+{
+    std::cout << "\n=== Test: Batch Order Submission ===" << std::endl;
+
+    auto& runtime = EngineRuntime::get_instance(4, 10000, 0, false, true);
+
+    assert(runtime.register_stock("IBM", 200.0, 1000));
+    assert(runtime.register_stock("ORCL", 150.0, 1000));
+    TickerId ibm = runtime.get_ticker_id("IBM");
+    TickerId orcl = runtime.get_ticker_id("ORCL");
+
+    // Two IBM orders, one ORCL order, and four rejects: short shares,
+    // zero quantity, unknown ticker, non-positive limit price
+    OrderId ids[7] = {9, 9, 9, 9, 9, 9, 9};
+    std::vector<OrderRequest> requests = {
+        {ibm,  OrderSide::BID, OrderType::LIMIT, 199.0, 10, 7, &ids[0]},
+        {orcl, OrderSide::BID, OrderType::LIMIT, 149.0,  5, 7, &ids[1]},
+        {ibm,  OrderSide::BID, OrderType::LIMIT, 200.0, 20, 7, &ids[2]},
+        {ibm,  OrderSide::ASK, OrderType::LIMIT, 210.0,  5, 7, &ids[3]},
+        {ibm,  OrderSide::BID, OrderType::LIMIT, 199.0,  0, 7, &ids[4]},
+        {static_cast<TickerId>(999), OrderSide::BID, OrderType::LIMIT, 1.0, 1, 7, &ids[5]},
+        {ibm,  OrderSide::BID, OrderType::LIMIT,  -5.0, 10, 7, &ids[6]},
+    };
+    assert(runtime.submit_orders(requests) == 3);
+    runtime.execute_batch();
+
+    assert(ids[0] != NULL_ORDER && ids[1] != NULL_ORDER && ids[2] != NULL_ORDER);
+    assert(ids[3] == NULL_ORDER && ids[4] == NULL_ORDER && ids[5] == NULL_ORDER);
+    assert(ids[6] == NULL_ORDER);
+    // A ticker group runs as one job, so its ids come out contiguous
+    assert(ids[2] == ids[0] + 1);
+
+    // The crossing bid traded against the IPO ask; ownership and
+    // balances flowed through the batch path
+    EngineStats ibm_stats = runtime.get_stats(ibm);
+    assert(ibm_stats.orders_placed == 3); // IPO seed + two accepted
+    assert(ibm_stats.trades == 1);
+    assert(ibm_stats.trade_volume == 20.0);
+    assert(runtime.has_sufficient_shares(IPO_HOLDER, ibm, 980.0));
+    assert(!runtime.has_sufficient_shares(IPO_HOLDER, ibm, 981.0));
+    assert(runtime.get_stats(orcl).orders_placed == 2);
+
+    bool cancelled = false;
+    runtime.cancel_order(ibm, ids[0], &cancelled, 7);
+    runtime.execute_batch();
+    assert(cancelled);
+
+    std::cout << "Batch order submission test passed" << std::endl;
+
+    runtime.reset();
+}
+
+void test_inline_mode()
+{
+    std::cout << "\n=== Test: Inline Mode (num_threads == 0) ===" << std::endl;
+
+    // Inline runtimes are built directly, not through the singleton -
+    // sweeps run one per coordinating thread
+    EngineRuntime runtime(0, 10000, 0, false, true);
+    assert(runtime.is_inline());
+
+    assert(runtime.register_stock("TXN", 180.0, 1000));
+    TickerId txn = runtime.get_ticker_id("TXN");
+
+    // Same API, but results are ready when the call returns - no
+    // execute_batch needed before reading them
+    OrderId bid_id = NULL_ORDER, rest_id = NULL_ORDER;
+    runtime.limit_order(txn, OrderSide::BID, 180.0, 25, &bid_id);
+    assert(bid_id != NULL_ORDER);
+    assert(runtime.get_stats(txn).trades == 1);
+    runtime.limit_order(txn, OrderSide::BID, 179.0, 10, &rest_id);
+    assert(rest_id != NULL_ORDER);
+
+    // Balances and ownership flow through the same dispatch bookkeeping
+    assert(runtime.has_sufficient_shares(IPO_HOLDER, txn, 975.0));
+    assert(!runtime.has_sufficient_shares(IPO_HOLDER, txn, 976.0));
+
+    // Future-style handles resolve immediately
+    auto handle = runtime.submit_market_order(txn, OrderSide::ASK, 5, IPO_HOLDER);
+    assert(handle.ready());
+    assert(handle.get() != NULL_ORDER);
+    assert(runtime.get_stats(txn).trades == 2);
+
+    // Batch submission runs the group inline too
+    OrderId ids[2] = {NULL_ORDER, NULL_ORDER};
+    std::vector<OrderRequest> requests = {
+        {txn, OrderSide::BID, OrderType::LIMIT, 178.0, 5, 7, &ids[0]},
+        {txn, OrderSide::BID, OrderType::LIMIT, 177.0, 5, 7, &ids[1]},
+    };
+    assert(runtime.submit_orders(requests) == 2);
+    assert(ids[0] != NULL_ORDER && ids[1] == ids[0] + 1);
+
+    bool cancelled = false;
+    runtime.cancel_order(txn, rest_id, &cancelled, 1);
+    assert(cancelled);
+
+    // execute_batch stays callable (per-batch bookkeeping only)
+    runtime.execute_batch();
+    assert(runtime.all_jobs_completed());
+
+    std::cout << "Inline mode test passed" << std::endl;
+}
+
+void test_headless_runtime()
+{
+    std::cout << "\n=== Test: Headless Runtime Specialization ===" << std::endl;
+
+    // Untracked ownership + engines with fixed policies: same API, no
+    // per-order ownership inserts, no notification code. Inline so the
+    // results are ready when the calls return.
+    HeadlessEngineRuntime runtime(0, 10000, 0, false, true);
+    assert(runtime.is_inline());
+    assert(runtime.register_stock("HLS", 50.0, 1000));
+    TickerId hls = runtime.get_ticker_id("HLS");
+
+    // Orders match exactly as on the default runtime
+    OrderId bid_id = NULL_ORDER, rest_id = NULL_ORDER;
+    runtime.limit_order(hls, OrderSide::BID, 50.0, 25, &bid_id);
+    assert(bid_id != NULL_ORDER);
+    assert(runtime.get_stats(hls).trades == 1);
+    runtime.limit_order(hls, OrderSide::BID, 49.0, 10, &rest_id);
+    bool cancelled = false;
+    runtime.cancel_order(hls, rest_id, &cancelled, 1);
+    assert(cancelled);
+
+    // Share balances are not part of the ownership policy - ASK-side
+    // validation still holds without tracking
+    assert(runtime.has_sufficient_shares(IPO_HOLDER, hls, 975.0));
+    assert(!runtime.has_sufficient_shares(IPO_HOLDER, hls, 976.0));
+    OrderId ask_id = NULL_ORDER;
+    runtime.limit_order(hls, OrderSide::ASK, 51.0, 5, &ask_id, 7); // User 7 owns nothing
+    assert(ask_id == NULL_ORDER);
+
+    // get_positions() reports tracking as compiled out (empty result)
+    assert(runtime.get_positions(IPO_HOLDER, "HLS").empty());
+
+    std::cout << "Headless runtime test passed" << std::endl;
+}
+
+void test_snapshot_restore()
+{
+    std::cout << "\n=== Test: Snapshot / Restore ===" << std::endl;
+
+    auto& runtime = EngineRuntime::get_instance(4, 10000, 0, false, true);
+    const std::string path = "/tmp/titan_runtime_snapshot.bin";
+
+    assert(runtime.register_stock("NFLX", 400.0, 1000));
+    TickerId nflx = runtime.get_ticker_id("NFLX");
+
+    // One cross against the IPO ask plus two resting bids
+    OrderId bid_id = -1, rest1 = -1, rest2 = -1;
+    runtime.limit_order(nflx, OrderSide::BID, 400.0, 25, &bid_id);
+    runtime.limit_order(nflx, OrderSide::BID, 399.0, 10, &rest1);
+    runtime.limit_order(nflx, OrderSide::BID, 398.0, 5, &rest2);
+    runtime.execute_batch();
+
+    EngineStats before = runtime.get_stats(nflx);
+    assert(before.trades == 1);
+    assert(before.bid_levels == 2);
+
+    assert(runtime.snapshot_all(path));
+    runtime.reset();
+    assert(runtime.get_ticker_id("NFLX") == INVALID_TICKER);
+
+    assert(runtime.restore_all(path));
+    nflx = runtime.get_ticker_id("NFLX");
+    assert(nflx != INVALID_TICKER);
+
+    // Counters and book shape survive the round trip
+    EngineStats after = runtime.get_stats(nflx);
+    assert(after.orders_placed == before.orders_placed);
+    assert(after.orders_matched == before.orders_matched);
+    assert(after.trades == before.trades);
+    assert(after.trade_volume == before.trade_volume);
+    assert(after.open_orders == before.open_orders);
+    assert(after.filled_orders == before.filled_orders);
+    assert(after.bid_levels == before.bid_levels);
+    assert(after.ask_levels == before.ask_levels);
+
+    // The IPO holder's sellable balance also survives (1000 - 25 filled)
+    assert(runtime.has_sufficient_shares(IPO_HOLDER, nflx, 975.0));
+    assert(!runtime.has_sufficient_shares(IPO_HOLDER, nflx, 976.0));
+
+    auto bids = runtime.get_market_depth("NFLX", OrderSide::BID, 4);
+    assert(bids.size() == 2);
+    assert(bids[0].first == 399.0 && bids[0].second == 10.0);
+    assert(bids[1].first == 398.0 && bids[1].second == 5.0);
+
+    // The restored book is live: cancel a pre-snapshot order and trade again
+    bool cancelled = false;
+    runtime.cancel_order(nflx, rest2, &cancelled, 1);
+    runtime.execute_batch();
+    assert(cancelled);
+
+    OrderId ask_id = -1;
+    runtime.limit_order(nflx, OrderSide::ASK, 399.0, 10, &ask_id, IPO_HOLDER);
+    runtime.execute_batch();
+    assert(runtime.get_stats(nflx).trades == before.trades + 1);
+
+    std::cout << "Snapshot/restore test passed" << std::endl;
+
+    runtime.reset();
+}
+
+// Counting strategy for the event bus test - records what the dispatch
+// thread delivers without submitting anything back
+struct CountingStrategy : public TradingStrategy
+{
+    std::atomic<int> fills{0};
+    std::atomic<int> cancels{0};
+    std::atomic<int> book_updates{0};
+    std::atomic<double> last_fill_price{-1.0};
+
+    void on_book_update(const std::string&, const OrderEngine*, EngineRuntime*) override
+    {
+        book_updates.fetch_add(1);
+    }
+
+    void on_fill(const std::string&, OrderId, Price price, Quantity) override
+    {
+        fills.fetch_add(1);
+        last_fill_price.store(price);
+    }
+
+    void on_cancel(const std::string&, OrderId) override
+    {
+        cancels.fetch_add(1);
+    }
+};
+
+void test_strategy_event_bus()
+{
+    std::cout << "\n=== Test: Strategy Event Bus ===" << std::endl;
+
+    auto& runtime = EngineRuntime::get_instance(4, 10000, 0, false, true);
+
+    assert(runtime.register_stock("AMD", 150.0, 1000));
+    TickerId amd = runtime.get_ticker_id("AMD");
+
+    CountingStrategy strategy;
+    assert(runtime.register_strategy(amd, &strategy));
+    assert(!runtime.register_strategy("NOPE", &strategy));
+
+    // Cross the book: one ask, one bid at the same price -> two fill events
+    OrderId ask_id = -1, bid_id = -1, rest_id = -1;
+    runtime.limit_order(amd, OrderSide::ASK, 149.0, 10, &ask_id, IPO_HOLDER);
+    runtime.limit_order(amd, OrderSide::BID, 149.0, 10, &bid_id);
+    runtime.limit_order(amd, OrderSide::BID, 148.0, 5, &rest_id);
+    runtime.execute_batch();
+
+    bool cancel_result = false;
+    runtime.cancel_order(amd, rest_id, &cancel_result, 1);
+    runtime.execute_batch();
+    assert(cancel_result);
+
+    // Delivery is asynchronous: give the dispatch thread a moment
+    for (int i = 0; i < 1000 && strategy.cancels.load() == 0; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    assert(strategy.fills.load() == 2);       // Both sides of the cross
+    assert(strategy.cancels.load() == 1);
+    assert(strategy.book_updates.load() >= 1); // Once per batch, not per event
+    assert(strategy.last_fill_price.load() == 149.0);
+
+    std::cout << "Delivered " << strategy.fills.load() << " fills, "
+              << strategy.cancels.load() << " cancels, "
+              << strategy.book_updates.load() << " book updates" << std::endl;
+
+    assert(runtime.unregister_strategy(amd, &strategy));
+    std::cout << "Strategy event bus test passed" << std::endl;
+
+    EngineRuntime::get_instance().reset();
+}
+
 int main(int argc, char* argv[])
 {
     std::cout << "========================================" << std::endl;
@@ -415,6 +807,14 @@ int main(int argc, char* argv[])
         //test_mixed_batch_operations();
         //test_multi_stock_batch();
         test_large_batch_performance();
+        test_request_handles();
+        test_strategy_event_bus();
+        test_engine_stats();
+        test_share_balances();
+        test_submit_orders();
+        test_inline_mode();
+        test_headless_runtime();
+        test_snapshot_restore();
         //test_sequential_vs_batch_comparison();
         //test_non_blocking_multi_stock();
         //test_monte_carlo_simulation();
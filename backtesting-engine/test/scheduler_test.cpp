@@ -295,7 +295,181 @@ void test_sequential_vs_parallel()
     std::cout << "✓ Sequential vs Parallel test PASSED!\n\n";
 }
 
+void test_concurrent_submission()
+{
+    std::cout << "=== Testing Concurrent Submission (Multi-Producer) ===\n";
+
+    const int NUM_PRODUCERS = 4;
+    const int JOBS_PER_PRODUCER = 50000;
+    std::atomic<int> counter{0};
+
+    {
+        // Single worker: all producers contend on the same queue
+        JobScheduler scheduler(1, NUM_PRODUCERS * JOBS_PER_PRODUCER);
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < NUM_PRODUCERS; ++p)
+        {
+            producers.emplace_back([&scheduler, &counter]() {
+                for (int i = 0; i < JOBS_PER_PRODUCER; ++i)
+                {
+                    Job job(
+                        [&counter]() { counter.fetch_add(1, std::memory_order_relaxed); },
+                        0
+                    );
+                    scheduler.submit_job(std::move(job));
+                }
+            });
+        }
+
+        for (auto& producer : producers)
+            producer.join();
+
+        scheduler.process_jobs();
+    }
+
+    std::cout << "Counter value: " << counter.load() << "\n";
+    assert(counter.load() == NUM_PRODUCERS * JOBS_PER_PRODUCER && "No job may be lost or duplicated under contention");
+
+    std::cout << "✓ Concurrent Submission test PASSED!\n\n";
+}
+
+
+
+void test_pinned_workers()
+{
+    std::cout << "=== Testing Pinned Workers ===\n";
+    std::atomic<int> counter{0};
+
+    {
+        // Pinning is best effort; behavior must be identical either way
+        JobScheduler scheduler(4, 1000, true);
+
+        for (int i = 0; i < 100; ++i)
+            scheduler.submit_job(Job(
+                [&counter]() { counter.fetch_add(1, std::memory_order_relaxed); },
+                static_cast<std::size_t>(i)));
+
+        scheduler.process_jobs();
+    }
+
+    assert(counter.load() == 100 && "All jobs should execute on pinned workers");
+    std::cout << "✓ Pinned Workers test PASSED!\n\n";
+}
+
+void test_worker_parking()
+{
+    std::cout << "=== Testing Worker Parking ===\n";
+    std::atomic<int> counter{0};
+
+    {
+        JobScheduler scheduler(4, 1000);
+
+        // Let the idle workers run out their spin budget and park
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
+        std::uint64_t parks = 0;
+        for (WorkerId w = 0; w < 4; ++w)
+            parks += scheduler.get_worker_stats(w).parks;
+        assert(parks > 0 && "Idle workers should park instead of spinning");
+
+        // Parked workers must wake on flush and run the batch
+        for (int i = 0; i < 100; ++i)
+            scheduler.submit_job(Job(
+                [&counter]() { counter.fetch_add(1, std::memory_order_relaxed); },
+                static_cast<std::size_t>(i)));
+        scheduler.process_jobs();
+        assert(counter.load() == 100 && "Parked workers should wake on flush");
+    }
+
+    std::cout << "✓ Worker Parking test PASSED!\n\n";
+}
+
+void test_blocking_submit()
+{
+    std::cout << "=== Testing Blocking Submit (Full Queue) ===\n";
+
+    const int NUM_JOBS = 64;
+    std::atomic<int> counter{0};
+
+    {
+        // Tiny queue: the producer outruns it and has to block for room
+        JobScheduler scheduler(1, 4);
+
+        std::thread producer([&scheduler, &counter]() {
+            for (int i = 0; i < NUM_JOBS; ++i)
+                scheduler.submit_job(Job(
+                    [&counter]() { counter.fetch_add(1, std::memory_order_relaxed); },
+                    0));
+        });
+
+        // Flush until the producer has pushed everything through (async:
+        // waiting for completion while a producer is still submitting
+        // would wait on a queue the producer keeps refilling)
+        while (counter.load(std::memory_order_relaxed) < NUM_JOBS)
+            scheduler.process_jobs_async();
+        producer.join();
+        scheduler.process_jobs();
+    }
+
+    assert(counter.load() == NUM_JOBS && "Blocking submit must not drop jobs");
+    std::cout << "✓ Blocking Submit test PASSED!\n\n";
+}
+
+void test_parallel_forks()
+{
+    std::cout << "=== Testing Parallel What-If Forks ===\n";
+
+    // Parent book: three ask levels and a last trade at 100
+    OrderEngine parent("WHATIF", 8192, false);
+    parent.place_order(OrderSide::ASK, OrderType::LIMIT, 100.0, 5);
+    parent.place_order(OrderSide::BID, OrderType::LIMIT, 100.0, 5); // Trades at 100
+    parent.place_order(OrderSide::ASK, OrderType::LIMIT, 101.0, 10);
+    parent.place_order(OrderSide::ASK, OrderType::LIMIT, 102.0, 10);
+    parent.place_order(OrderSide::ASK, OrderType::LIMIT, 103.0, 10);
+    parent.place_order(OrderSide::BID, OrderType::LIMIT, 99.0, 30);
+
+    // One cheap fork per candidate action, evaluated on separate workers
+    constexpr std::size_t K = 4;
+    std::vector<std::unique_ptr<OrderEngine>> forks;
+    for (std::size_t k = 0; k < K; ++k)
+    {
+        forks.push_back(std::make_unique<OrderEngine>("WHATIF", 64, false));
+        forks[k]->fork_from(parent);
+    }
+
+    {
+        JobScheduler scheduler(K, 64);
+        double results[K] = {};
+        for (std::size_t k = 0; k < K; ++k)
+        {
+            OrderEngine* fork = forks[k].get();
+            double* out = &results[k];
+            scheduler.submit_job(Job(
+                [fork, out, k]()
+                {
+                    // Candidate k lifts k+1 levels, one slice per order
+                    // (each aggressive limit pegs to the best ask at entry)
+                    for (std::size_t i = 0; i <= k; ++i)
+                        fork->place_order(OrderSide::BID, OrderType::LIMIT, 110.0, 10);
+                    *out = fork->get_market_price();
+                },
+                k), static_cast<WorkerId>(k));
+        }
+        scheduler.process_jobs();
+
+        // Each candidate walked a different depth into its own book copy
+        assert(results[0] == 101.0 && results[1] == 102.0);
+        assert(results[2] == 103.0 && results[3] == 103.0);
+    }
+
+    // The shared parent never saw any of the hypothetical trades
+    assert(parent.get_market_price() == 100.0 && "Parent last trade untouched");
+    assert(parent.get_best_ask() == 101.0 && "Parent asks untouched");
+    assert(parent.get_level_count(OrderSide::ASK) == 3);
+
+    std::cout << "✓ Parallel What-If Forks test PASSED!\n\n";
+}
 
 int main()
 {
@@ -309,9 +483,14 @@ int main()
     test_round_robin_distribution();
     test_computational_jobs();
     test_empty_check();
+    test_concurrent_submission();
     test_stress_submission();
     test_sequential_vs_parallel();
-    
+    test_pinned_workers();
+    test_worker_parking();
+    test_blocking_submit();
+    test_parallel_forks();
+
     std::cout << "========================================\n";
     std::cout << "  All Scheduler Tests PASSED! ✓\n";
     std::cout << "========================================\n";
@@ -1,8 +1,9 @@
 #pragma once
 #include "order_engine.cpp"
 
-// Forward declaration
-class EngineRuntime;
+// This file is included at the bottom of engine_runtime.cpp, so the
+// EngineRuntime alias (the default BasicEngineRuntime instantiation the
+// callbacks are typed on) is already visible here.
 
 // Strategy callback interface
 // Inherit from this to create custom trading strategies that react to order book updates
@@ -12,7 +13,9 @@ struct TradingStrategy
     
     // Called on each book update with read-only access to engine
     // @param ticker - The stock ticker symbol
-    // @param engine - Const pointer to OrderEngine for reading book data (thread-safe reads)
+    // @param engine - Const pointer to OrderEngine for reading book data
+    //                  (use get_top_of_book() - it is the seqlock-published
+    //                  snapshot, safe while the owning worker matches)
     // @param runtime - Pointer to EngineRuntime for submitting new orders
     virtual void on_book_update(const std::string& ticker, const OrderEngine* engine, EngineRuntime* runtime) = 0;
     
@@ -46,9 +49,10 @@ public:
     
     void on_book_update(const std::string& ticker, const OrderEngine* engine, EngineRuntime* runtime) override
     {
-        // Read current book state (const access is thread-safe)
-        Price best_bid = engine->get_best_bid();
-        Price best_ask = engine->get_best_ask();
+        // Read the seqlock-published snapshot - never the live book
+        const BookTop top = engine->get_top_of_book();
+        Price best_bid = top.best_bid;
+        Price best_ask = top.best_ask;
         
         // Check if book has liquidity
         if (best_bid <= 0 || best_ask <= 0)
@@ -141,7 +145,8 @@ public:
     
     void on_book_update(const std::string& ticker, const OrderEngine* engine, EngineRuntime* runtime) override
     {
-        Price mid = (engine->get_best_bid() + engine->get_best_ask()) / 2.0;
+        const BookTop top = engine->get_top_of_book();
+        Price mid = (top.best_bid + top.best_ask) / 2.0;
         
         if (mid <= 0)
             return;
@@ -199,8 +204,9 @@ public:
     
     void on_book_update(const std::string& ticker, const OrderEngine* engine, EngineRuntime* runtime) override
     {
-        // Store prices for both symbols
-        Price mid = (engine->get_best_bid() + engine->get_best_ask()) / 2.0;
+        // Store prices for both symbols (snapshot read - see BookTop)
+        const BookTop top = engine->get_top_of_book();
+        Price mid = (top.best_bid + top.best_ask) / 2.0;
         
         if (ticker == symbol_a_)
             price_a_ = mid;
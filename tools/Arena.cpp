@@ -1,34 +1,97 @@
 #pragma once
 #include <vector>
+#include <memory>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <cstdint>
+#include <cstring>
+
+// Chunked growable arena. Storage is a list of fixed-size blocks and an
+// index splits into block/offset (shift and mask), so growing appends a
+// block without moving anything: every outstanding Index, reference and
+// pointer stays valid for the arena's lifetime. operator[] stays at two
+// dereferences - block table, then slot.
 template <typename T>
 struct Arena
 {
     using Index = std::uint32_t;
 
+    // The capacity hint fixes this arena's block size (rounded up to a
+    // power of two, min 64): sized right, the hot path never allocates,
+    // and a volume spike costs one extra block instead of an overflow.
     Arena(std::size_t capacity) noexcept
     {
-        data_.reserve(capacity);
+        std::size_t block = 64;
+        while (block < capacity)
+            block <<= 1;
+        block_size_ = block;
+        block_mask_ = block - 1;
+        block_shift_ = 0;
+        while ((std::size_t(1) << block_shift_) < block)
+            ++block_shift_;
         free_.reserve(capacity / 2);
     }
 
-    Index allocate(T&& value) noexcept
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    Arena(Arena&& other) noexcept
+    : blocks_(std::move(other.blocks_)), free_(std::move(other.free_)), size_(other.size_),
+      block_size_(other.block_size_), block_mask_(other.block_mask_), block_shift_(other.block_shift_),
+      owned_(std::move(other.owned_)), shared_blocks_(other.shared_blocks_)
     {
-        // Check if we can reuse a free slot
-        if (!free_.empty())
+        other.size_ = 0;
+        other.shared_blocks_ = 0;
+    }
+
+    Arena& operator=(Arena&& other) noexcept
+    {
+        if (this != &other)
         {
-            Index idx = free_.back();
-            free_.pop_back();
-            // Reuse existing slot by move-assigning new value over old one
-            data_[idx] = std::move(value);
-            return idx;
+            destroy_all();
+            blocks_ = std::move(other.blocks_);
+            free_ = std::move(other.free_);
+            size_ = other.size_;
+            block_size_ = other.block_size_;
+            block_mask_ = other.block_mask_;
+            block_shift_ = other.block_shift_;
+            owned_ = std::move(other.owned_);
+            shared_blocks_ = other.shared_blocks_;
+            other.size_ = 0;
+            other.shared_blocks_ = 0;
         }
-        
-        // Check if we have space to add a new element
-        if (data_.size() >= data_.capacity())
-            return -1;
-        
-        data_.push_back(std::move(value));
-        return static_cast<Index>(data_.size() - 1);
+        return *this;
+    }
+
+    // Copy-on-write fork: the clone shares every block with this arena,
+    // and each side copies a block privately on first write, so the fork
+    // itself costs one block-table copy no matter how many slots are
+    // live. Restricted to trivially copyable, trivially destructible
+    // slots (true for the order records) so a block copy is a memcpy and
+    // shared blocks need no destructor pass.
+    Arena fork() noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "fork shares raw blocks between arenas");
+        Arena clone(block_size_);
+        clone.blocks_ = blocks_; // Shared_ptr copies - no slot data moves
+        clone.free_ = free_;
+        clone.size_ = size_;
+        clone.owned_.assign(blocks_.size(), false);
+        clone.shared_blocks_ = blocks_.size();
+        // The parent's blocks are now shared too: its next write to each
+        // block takes its own private copy
+        owned_.assign(blocks_.size(), false);
+        shared_blocks_ = blocks_.size();
+        return clone;
+    }
+
+    ~Arena() { destroy_all(); }
+
+    Index allocate(T&& value) noexcept
+    {
+        return emplace(std::move(value));
     }
 
     template <typename... Args>
@@ -39,16 +102,32 @@ struct Arena
         {
             Index idx = free_.back();
             free_.pop_back();
-            data_[idx] = T(std::forward<Args>(args)...);
+            // Reuse existing slot by move-assigning new value over old one
+            (*this)[idx] = T(std::forward<Args>(args)...);
             return idx;
         }
-        
-        // Check if we have space to add a new element
-        if (data_.size() >= data_.capacity())
-            return -1;
-        
-        data_.emplace_back(std::forward<Args>(args)...);
-        return static_cast<Index>(data_.size() - 1);
+
+        // Index space exhausted (the sentinel itself is not addressable)
+        if (size_ >= static_cast<std::size_t>(static_cast<Index>(-1)))
+            return static_cast<Index>(-1);
+
+        // Grow by one block if the tail block is full - existing blocks
+        // never move, so outstanding references survive the growth
+        const Index idx = static_cast<Index>(size_);
+        if ((idx >> block_shift_) == blocks_.size())
+        {
+            Slot* block = new (std::nothrow) Slot[block_size_];
+            if (!block)
+                return static_cast<Index>(-1); // Out of memory
+            blocks_.emplace_back(block);
+            owned_.push_back(true); // Fresh blocks are never shared
+        }
+        else if (shared_blocks_ != 0)
+            ensure_owned(idx >> block_shift_); // Tail block may be forked
+
+        new (&blocks_[idx >> block_shift_][idx & block_mask_]) T(std::forward<Args>(args)...);
+        ++size_;
+        return idx;
     }
 
     void free(Index idx) noexcept
@@ -58,21 +137,71 @@ struct Arena
 
     T& operator[](Index idx) noexcept
     {
-        return data_[idx];
+        // A mutable reference is a write as far as sharing is concerned.
+        // Unforked arenas pay one compare against a hot member.
+        if (shared_blocks_ != 0)
+            ensure_owned(idx >> block_shift_);
+        return *std::launder(reinterpret_cast<T*>(&blocks_[idx >> block_shift_][idx & block_mask_]));
     }
 
-    const T& operator[](Index idx) const noexcept 
+    const T& operator[](Index idx) const noexcept
     {
-        return data_[idx];
+        return *std::launder(reinterpret_cast<const T*>(&blocks_[idx >> block_shift_][idx & block_mask_]));
     }
 
+    // Slots ever constructed (live + free-listed)
+    std::size_t size() const noexcept { return size_; }
+
+    // Slots available without allocating another block
+    std::size_t capacity() const noexcept { return blocks_.size() * block_size_; }
+
     void reset() noexcept
     {
-        data_.clear();
+        destroy_all();
+        // Shared blocks still back a forked sibling - drop them instead
+        // of reusing their storage for new slots
+        if (shared_blocks_ != 0)
+        {
+            blocks_.clear();
+            owned_.clear();
+            shared_blocks_ = 0;
+        }
+        size_ = 0;
         free_.clear();
     }
 
 private:
-    std::vector<T> data_;
+    // Raw aligned storage: slots are constructed lazily by emplace, so T
+    // needs no default constructor and fresh blocks are never zeroed
+    using Slot = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    void destroy_all() noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            for (std::size_t i = 0; i < size_; ++i)
+                (*this)[static_cast<Index>(i)].~T();
+        }
+    }
+
+    // Helper: Take a private copy of a block the fork still shares
+    void ensure_owned(std::size_t block) noexcept
+    {
+        if (owned_[block])
+            return;
+        Slot* copy = new Slot[block_size_];
+        std::memcpy(copy, blocks_[block].get(), block_size_ * sizeof(Slot));
+        blocks_[block].reset(copy);
+        owned_[block] = true;
+        --shared_blocks_;
+    }
+
+    std::vector<std::shared_ptr<Slot[]>> blocks_; // Block table (blocks keep capacity across reset; shared after a fork)
     std::vector<Index> free_;
-};
\ No newline at end of file
+    std::size_t size_ = 0;
+    std::size_t block_size_; // Fixed per arena, power of two
+    std::size_t block_mask_;
+    unsigned block_shift_;
+    std::vector<bool> owned_; // Per-block: is this side's copy private?
+    std::size_t shared_blocks_ = 0; // Blocks still shared with a fork (0 = no CoW checks)
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include <vector>
+#include <unordered_map>
 
 enum class HeapType
 {
@@ -120,4 +121,131 @@ private:
             idx = best_child;
         }
     }
-};
\ No newline at end of file
+};
+// Heap that additionally tracks each element's heap index in a map,
+// so find() is O(1) and pop-at-element is O(log n) instead of the
+// linear scan Heap::find does. Elements must be unique.
+template <typename T, HeapType TYPE = HeapType::MIN>
+struct IndexedHeap
+{
+private:
+    static constexpr std::size_t ELEMENTS_PER_LINE = 64 / sizeof(T); // L1 Cache Line Size
+    static constexpr std::size_t RESERVED_SIZE = ELEMENTS_PER_LINE * 128; // Default Buffer Size
+
+public:
+    IndexedHeap() noexcept
+    {
+        heap_.reserve(RESERVED_SIZE);
+        pos_.reserve(RESERVED_SIZE);
+    }
+
+    void push(T data) noexcept
+    {
+        heap_.push_back(data);
+        pos_[data] = heap_.size() - 1;
+        heapify_up(heap_.size() - 1);
+    }
+
+    void pop(const int idx = 0) noexcept
+    {
+        if (!heap_.size()) return;
+        pos_.erase(heap_[idx]);
+        if (idx == static_cast<int>(heap_.size()) - 1)
+        {
+            heap_.pop_back();
+            return;
+        }
+        heap_[idx] = heap_.back();
+        heap_.pop_back();
+        pos_[heap_[idx]] = idx;
+        // The element swapped in may need to move either direction
+        heapify_up(idx);
+        heapify_down(idx);
+    }
+
+    T peek(int idx = 0) const noexcept { return heap_[idx]; }
+
+    int find(T data) const noexcept
+    {
+        auto it = pos_.find(data);
+        return it == pos_.end() ? -1 : static_cast<int>(it->second);
+    }
+
+    int size() const noexcept { return heap_.size(); }
+    bool empty() const noexcept { return !heap_.size(); }
+
+private:
+    std::vector<T> heap_;
+    std::unordered_map<T, std::size_t> pos_; // Element -> heap index
+
+    // For Pushing from the End
+    void heapify_up(std::size_t idx)
+    {
+        while (idx > 0)
+        {
+            std::size_t parent = (idx - 1) / 2;
+            if constexpr (TYPE == HeapType::MIN)
+            {
+                if (heap_[idx] >= heap_[parent]) break;
+            }
+            else
+            {
+                if (heap_[idx] <= heap_[parent]) break;
+            }
+            swap_elements(idx, parent);
+            idx = parent;
+        }
+    }
+
+    // For Popping from Front
+    void heapify_down(std::size_t idx)
+    {
+        while (true)
+        {
+            std::size_t left_child = (idx * 2) + 1;
+            std::size_t right_child = (idx * 2) + 2;
+            std::size_t best_child = idx;
+
+            if (left_child < heap_.size())
+            {
+                if constexpr (TYPE == HeapType::MIN)
+                {
+                    if (heap_[left_child] < heap_[best_child])
+                        best_child = left_child;
+                }
+                else
+                {
+                    if (heap_[left_child] > heap_[best_child])
+                        best_child = left_child;
+                }
+            }
+
+            if (right_child < heap_.size())
+            {
+                if constexpr (TYPE == HeapType::MIN)
+                {
+                    if (heap_[right_child] < heap_[best_child])
+                        best_child = right_child;
+                }
+                else
+                {
+                    if (heap_[right_child] > heap_[best_child])
+                        best_child = right_child;
+                }
+            }
+
+            if (best_child == idx) break;
+
+            swap_elements(idx, best_child);
+            idx = best_child;
+        }
+    }
+
+    // Swap two elements and keep the position map in sync
+    void swap_elements(std::size_t a, std::size_t b)
+    {
+        std::swap(heap_[a], heap_[b]);
+        pos_[heap_[a]] = a;
+        pos_[heap_[b]] = b;
+    }
+};
@@ -0,0 +1,333 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+
+// One executed trade, as the matching loop emits it: price, size and the
+// engine's monotonic trade sequence. No clock read on the matching path -
+// trades are stamped into time buckets by the aggregation thread.
+struct TradeTick
+{
+    double price;
+    double qty;
+    std::uint64_t seq; // Engine trade count at emission (per-engine order)
+};
+
+// Single-producer single-consumer ring of trade ticks. The producer is the
+// engine's owning worker, the consumer is the candle aggregation thread.
+// Push is a bounds check, a struct copy and a release store - it never
+// blocks the matching path; overflow drops the tick and counts it.
+class TradeRing
+{
+public:
+    explicit TradeRing(std::size_t capacity) noexcept
+    {
+        // Round up to a power of two so wrap-around is a mask
+        std::size_t cap = 1;
+        while (cap < capacity)
+            cap <<= 1;
+        buffer_.resize(cap);
+        mask_ = cap - 1;
+    }
+
+    bool try_push(const TradeTick& tick) noexcept
+    {
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        const std::uint64_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail > mask_)
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false; // Ring full - aggregation thread is behind
+        }
+        buffer_[head & mask_] = tick;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(TradeTick& out) noexcept
+    {
+        const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+        const std::uint64_t head = head_.load(std::memory_order_acquire);
+        if (tail == head)
+            return false;
+        out = buffer_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<TradeTick> buffer_;
+    std::size_t mask_;
+    std::atomic<std::uint64_t> head_{0}; // Producer cursor
+    std::atomic<std::uint64_t> tail_{0}; // Consumer cursor
+    std::atomic<std::uint64_t> dropped_{0};
+};
+
+// One OHLCV bucket. bucket is the interval index (start time divided by
+// the interval length), so consecutive candles differ by at least one.
+struct Candle
+{
+    std::uint64_t bucket = 0;
+    double open = 0;
+    double high = 0;
+    double low = 0;
+    double close = 0;
+    double volume = 0;
+    std::uint64_t trades = 0;
+};
+
+// Flat ring of completed candles plus one live in-progress bucket, written
+// only by the aggregation thread. Completed candles are immutable once
+// committed, so readers index them with a single acquire load and an
+// overwrite recheck; the live bucket goes through a seqlock, same idiom as
+// the engine's top-of-book snapshot. Empty intervals produce no candle.
+class CandleSeries
+{
+public:
+    explicit CandleSeries(std::size_t capacity) noexcept
+    {
+        std::size_t cap = 1;
+        while (cap < capacity)
+            cap <<= 1;
+        slots_.resize(cap);
+        mask_ = cap - 1;
+    }
+
+    // WRITER (aggregation thread): fold one trade into its bucket,
+    // committing the previous bucket if this trade starts a new one
+    void fold(std::uint64_t bucket, double price, double qty) noexcept
+    {
+        if (!live_valid_ || live_.bucket != bucket)
+        {
+            commit_live();
+            const std::uint64_t seq = begin_write();
+            live_ = Candle{bucket, price, price, price, price, 0, 0};
+            live_valid_ = true;
+            end_write(seq);
+        }
+
+        const std::uint64_t seq = begin_write();
+        if (price > live_.high) live_.high = price;
+        if (price < live_.low)  live_.low = price;
+        live_.close = price;
+        live_.volume += qty;
+        live_.trades += 1;
+        end_write(seq);
+    }
+
+    // WRITER: commit the live bucket if time has moved past it, so a
+    // candle still closes when no further trades arrive
+    void roll(std::uint64_t bucket) noexcept
+    {
+        if (live_valid_ && live_.bucket < bucket)
+        {
+            commit_live();
+            const std::uint64_t seq = begin_write();
+            live_valid_ = false;
+            end_write(seq);
+        }
+    }
+
+    // GET: Completed candles committed so far (monotonic)
+    std::uint64_t size() const noexcept { return completed_.load(std::memory_order_acquire); }
+
+    // GET: Completed candle by absolute index (0 = first ever committed).
+    // False if not yet committed or already overwritten by ring wrap.
+    bool get(std::uint64_t idx, Candle& out) const noexcept
+    {
+        if (idx >= completed_.load(std::memory_order_acquire))
+            return false;
+        out = slots_[idx & mask_];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // The writer may have lapped the slot while we copied
+        return completed_.load(std::memory_order_relaxed) - idx <= mask_ + 1;
+    }
+
+    // GET: The live in-progress bucket - false when no trade has opened
+    // one. Seqlock copy, safe from any thread.
+    bool current(Candle& out) const noexcept
+    {
+        for (;;)
+        {
+            const std::uint64_t before = live_seq_.load(std::memory_order_acquire);
+            if (before & 1)
+                continue; // Write in progress - retry
+            const bool valid = live_valid_;
+            out = live_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (live_seq_.load(std::memory_order_relaxed) == before)
+                return valid;
+        }
+    }
+
+private:
+    std::uint64_t begin_write() noexcept
+    {
+        const std::uint64_t seq = live_seq_.load(std::memory_order_relaxed);
+        live_seq_.store(seq + 1, std::memory_order_relaxed); // Odd: write begins
+        std::atomic_thread_fence(std::memory_order_release);
+        return seq;
+    }
+
+    void end_write(std::uint64_t seq) noexcept
+    {
+        live_seq_.store(seq + 2, std::memory_order_release); // Even: write complete
+    }
+
+    void commit_live() noexcept
+    {
+        if (!live_valid_)
+            return;
+        const std::uint64_t n = completed_.load(std::memory_order_relaxed);
+        slots_[n & mask_] = live_;
+        completed_.store(n + 1, std::memory_order_release);
+    }
+
+    std::vector<Candle> slots_; // Completed candles, ring-indexed
+    std::size_t mask_;
+    std::atomic<std::uint64_t> completed_{0}; // Candles committed (writer bumps after copy)
+
+    Candle live_;              // In-progress bucket (seqlock-guarded)
+    bool live_valid_ = false;  // A trade has opened the live bucket
+    std::atomic<std::uint64_t> live_seq_{0}; // Odd = live write in flight
+};
+
+// Incremental OHLCV aggregation. Engines push executed trades into
+// per-engine SPSC rings; one dedicated aggregation thread drains every
+// ring and folds each trade into its feed's candle series - O(1) per
+// trade, no polling and no lost trades between samples. Buckets are cut
+// on the steady clock at drain time, so the matching path stays clock-free.
+class CandleEngine
+{
+public:
+    explicit CandleEngine(std::chrono::nanoseconds interval,
+                          std::size_t ring_capacity = 1 << 16,
+                          std::size_t history = 1 << 10)
+    : interval_ns_(static_cast<std::uint64_t>(interval.count()) > 0
+                       ? static_cast<std::uint64_t>(interval.count()) : 1),
+      ring_capacity_(ring_capacity), history_(history)
+    {
+        aggregation_thread_ = std::thread([this]() { aggregate_loop(); });
+    }
+
+    CandleEngine(const CandleEngine&) = delete;
+    CandleEngine& operator=(const CandleEngine&) = delete;
+
+    ~CandleEngine() { close(); }
+
+    // Register a new producer; the returned feed's ring and series stay
+    // valid for the candle engine's lifetime (engines hold the raw ring)
+    std::size_t create_feed()
+    {
+        std::lock_guard<std::mutex> lock(feeds_mutex_);
+        feeds_.push_back(std::make_unique<Feed>(ring_capacity_, history_));
+        return feeds_.size() - 1;
+    }
+
+    // GET: The ring a feed's engine pushes into
+    TradeRing* feed_ring(std::size_t feed) noexcept
+    {
+        std::lock_guard<std::mutex> lock(feeds_mutex_);
+        return feed < feeds_.size() ? &feeds_[feed]->ring : nullptr;
+    }
+
+    // GET: A feed's candle series - lock-free to read, any thread
+    const CandleSeries* feed_series(std::size_t feed) const noexcept
+    {
+        std::lock_guard<std::mutex> lock(feeds_mutex_);
+        return feed < feeds_.size() ? &feeds_[feed]->series : nullptr;
+    }
+
+    // GET: Candle interval length
+    std::chrono::nanoseconds interval() const noexcept
+    {
+        return std::chrono::nanoseconds(interval_ns_);
+    }
+
+    // Trade ticks lost to full rings across all feeds
+    std::uint64_t dropped_trades() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(feeds_mutex_);
+        std::uint64_t total = 0;
+        for (const auto& feed : feeds_)
+            total += feed->ring.dropped();
+        return total;
+    }
+
+    // Stop aggregating after a final sweep of every ring
+    void close() noexcept
+    {
+        bool was_running = running_.exchange(false, std::memory_order_acq_rel);
+        if (!was_running)
+            return;
+        if (aggregation_thread_.joinable())
+            aggregation_thread_.join();
+    }
+
+private:
+    // One producer's ring and the series its trades fold into
+    struct Feed
+    {
+        Feed(std::size_t ring_capacity, std::size_t history)
+        : ring(ring_capacity), series(history)
+        {
+        }
+        TradeRing ring;
+        CandleSeries series;
+    };
+
+    std::uint64_t now_bucket() const noexcept
+    {
+        const std::uint64_t now_ns = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        return now_ns / interval_ns_;
+    }
+
+    void aggregate_loop() noexcept
+    {
+        TradeTick tick;
+        while (running_.load(std::memory_order_acquire))
+        {
+            if (!aggregate_once(tick))
+                std::this_thread::yield();
+        }
+        // Final sweep so no tick queued before close() is lost
+        while (aggregate_once(tick)) {}
+    }
+
+    bool aggregate_once(TradeTick& tick) noexcept
+    {
+        // One clock read per pass: every tick drained in the pass lands in
+        // the current bucket, and stale live buckets are rolled closed
+        const std::uint64_t bucket = now_bucket();
+        bool drained = false;
+        std::lock_guard<std::mutex> lock(feeds_mutex_);
+        for (auto& feed : feeds_)
+        {
+            while (feed->ring.try_pop(tick))
+            {
+                feed->series.fold(bucket, tick.price, tick.qty);
+                drained = true;
+            }
+            feed->series.roll(bucket);
+        }
+        return drained;
+    }
+
+    std::uint64_t interval_ns_;
+    std::size_t ring_capacity_;
+    std::size_t history_;
+
+    mutable std::mutex feeds_mutex_;
+    std::vector<std::unique_ptr<Feed>> feeds_;
+
+    std::thread aggregation_thread_;
+    std::atomic<bool> running_{true};
+};
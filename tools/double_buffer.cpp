@@ -4,25 +4,52 @@
 #include <algorithm>
 #include <utility>
 #include <thread>
+#include <chrono>
+#include <cstdint>
 
 template <typename T>
 class DoubleBuffer
 {
 private:
+    // Top bit of write_state_ is the swap-requested flag, the rest is the
+    // claimed-slot count. Packing both into one word lets producers claim
+    // slots with a single CAS and lets flush() close the batch atomically -
+    // no producer can sneak a claim in after the flag is raised.
+    static constexpr std::size_t SWAP_FLAG = std::size_t(1) << (sizeof(std::size_t) * 8 - 1);
+
     std::vector<T> buffer_a_;
     std::vector<T> buffer_b_;
-    
+
     // Use atomic pointers to vectors
     std::atomic<std::vector<T>*> write_buffer_;
     std::atomic<std::vector<T>*> read_buffer_;
-    
-    std::atomic<bool> swap_requested_{false};
-    
+
     std::atomic<std::size_t> read_index_{0};
-    std::atomic<std::size_t> write_index_{0};
+    std::atomic<std::size_t> write_state_{0};     // SWAP_FLAG | slots claimed by producers
+    std::atomic<std::size_t> write_committed_{0}; // Slots fully written out
     std::atomic<std::size_t> read_size_{0};
     std::size_t capacity_;
-    
+
+    // Stats only - never read on the push/pop fast path
+    std::atomic<std::size_t> high_water_{0};
+    std::atomic<std::uint64_t> flush_stalls_{0};
+
+    bool swap_requested() const noexcept
+    {
+        return write_state_.load(std::memory_order_acquire) & SWAP_FLAG;
+    }
+
+    // Flush-stall wait: bounded yield, then brief sleeps. A stall on a
+    // straggling producer clears in nanoseconds, but waiting out a busy
+    // consumer can take a whole batch - no reason to burn a core for it.
+    static void stall_backoff(std::size_t& spins) noexcept
+    {
+        if (++spins < 1024)
+            std::this_thread::yield();
+        else
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+
 public:
     explicit DoubleBuffer(std::size_t capacity) noexcept
     : capacity_(capacity)
@@ -37,9 +64,12 @@ public:
     DoubleBuffer(DoubleBuffer&& other) noexcept
     : buffer_a_(std::move(other.buffer_a_))
     , buffer_b_(std::move(other.buffer_b_))
-    , swap_requested_(other.swap_requested_.load())
     , read_index_(other.read_index_.load())
+    , write_state_(other.write_state_.load())
+    , write_committed_(other.write_committed_.load())
     , capacity_(other.capacity_)
+    , high_water_(other.high_water_.load())
+    , flush_stalls_(other.flush_stalls_.load())
     {
         auto* other_write = other.write_buffer_.load();
         auto* other_read = other.read_buffer_.load();
@@ -61,9 +91,12 @@ public:
         {
             buffer_a_ = std::move(other.buffer_a_);
             buffer_b_ = std::move(other.buffer_b_);
-            swap_requested_.store(other.swap_requested_.load());
             read_index_.store(other.read_index_.load());
+            write_state_.store(other.write_state_.load());
+            write_committed_.store(other.write_committed_.load());
             capacity_ = other.capacity_;
+            high_water_.store(other.high_water_.load());
+            flush_stalls_.store(other.flush_stalls_.load());
             
             auto* other_write = other.write_buffer_.load();
             auto* other_read = other.read_buffer_.load();
@@ -84,37 +117,87 @@ public:
     DoubleBuffer(const DoubleBuffer&) = delete;
     DoubleBuffer& operator=(const DoubleBuffer&) = delete;
 
+    // Multi-producer safe: any number of threads may push concurrently
     bool try_push(T&& value) noexcept
     {
-        // If requesting swap, then fail push
-        if (swap_requested_.load(std::memory_order_acquire))
-            return false;
+        // Claim a write slot with a CAS on the packed state word
+        std::size_t state = write_state_.load(std::memory_order_acquire);
+        for (;;)
+        {
+            // If requesting swap, then fail push
+            if (state & SWAP_FLAG)
+                return false;
 
-        // Check if write idx is at capacity
-        auto widx = write_index_.load(std::memory_order_relaxed);
-        if (widx >= capacity_) 
-            return false;
+            // Check if claimed count is at capacity
+            if (state >= capacity_)
+                return false;
+
+            if (write_state_.compare_exchange_weak(state, state + 1,
+                    std::memory_order_acq_rel, std::memory_order_acquire))
+                break;
+        }
 
-        // Insert new value, and itterate idx
+        // Slot is ours; flush() cannot swap until we commit it below
         auto* w = write_buffer_.load(std::memory_order_relaxed);
-        (*w)[widx] = std::move(value);
-        write_index_.store(widx + 1, std::memory_order_release);
+        (*w)[state] = std::move(value);
+        write_committed_.fetch_add(1, std::memory_order_release);
+
+        // Track the occupancy high-water mark (racy max is fine for stats)
+        if (state + 1 > high_water_.load(std::memory_order_relaxed))
+            high_water_.store(state + 1, std::memory_order_relaxed);
         return true;
     }
-    
+
+    // Multi-flusher safe: submitters that cross the auto-batch threshold
+    // can flush the same queue concurrently, and two swaps of one batch
+    // would re-deliver the old jobs and drop the new ones
     void flush() noexcept
     {
-        // Check if write idx is 0
-        auto write_sz = write_index_.load(std::memory_order_acquire);
-        if (write_sz == 0) 
+        // Raise the swap flag and read the final claim count in one shot -
+        // producers can no longer claim slots after this. If the flag was
+        // already up, another flusher owns the swap: wait it out, then
+        // claim again so everything buffered before this call is published
+        // by the time we return.
+        std::size_t write_sz;
+        for (;;)
+        {
+            const std::size_t prev = write_state_.fetch_or(SWAP_FLAG, std::memory_order_acq_rel);
+            if (!(prev & SWAP_FLAG))
+            {
+                write_sz = prev;
+                break;
+            }
+            std::size_t spins = 0;
+            while (swap_requested())
+                stall_backoff(spins);
+        }
+        if (write_sz == 0)
+        {
+            // Nothing buffered; clear the flag (no producer can claim while it is set)
+            write_state_.store(0, std::memory_order_release);
             return;
+        }
 
-        // Ask consumer to finish the current read buffer
-        swap_requested_.store(true, std::memory_order_release);
+        // Wait until every claimed slot is fully written
+        bool stalled = false;
+        std::size_t spins = 0;
+        while (write_committed_.load(std::memory_order_acquire) < write_sz)
+        {
+            stalled = true;
+            stall_backoff(spins);
+        }
 
         // Wait until consumer drained read buffer
         while (read_index_.load(std::memory_order_acquire) < read_size_.load(std::memory_order_acquire))
-            std::this_thread::yield();
+        {
+            stalled = true;
+            stall_backoff(spins);
+        }
+
+        // Count flushes that had to wait on a straggling producer or a
+        // consumer still working through the previous batch
+        if (stalled)
+            flush_stalls_.fetch_add(1, std::memory_order_relaxed);
 
         // Swap buffers
         auto* w = write_buffer_.load(std::memory_order_relaxed);
@@ -125,21 +208,21 @@ public:
         // Publish the new readable size
         read_size_.store(write_sz, std::memory_order_release);
         read_index_.store(0, std::memory_order_release);
-        write_index_.store(0, std::memory_order_release);
+        write_committed_.store(0, std::memory_order_release);
 
-        // Swap complete
-        swap_requested_.store(false, std::memory_order_release);
+        // Swap complete - clears the flag and the claim count together
+        write_state_.store(0, std::memory_order_release);
     }
-    
+
     bool try_pop(T& out) noexcept
     {
         std::size_t idx  = read_index_.load(std::memory_order_acquire);
         std::size_t size = read_size_.load(std::memory_order_acquire);
 
-        if (idx >= size) 
+        if (idx >= size)
         {
             // If producer is waiting to swap, yield to let it proceed
-            if (swap_requested_.load(std::memory_order_acquire))
+            if (swap_requested())
                 std::this_thread::yield();
             return false;
         }
@@ -155,21 +238,19 @@ public:
     {
         std::size_t read_idx = read_index_.load(std::memory_order_acquire);
         std::size_t read_sz = read_size_.load(std::memory_order_acquire);
-        std::size_t write_idx = write_index_.load(std::memory_order_acquire);
-        return read_idx >= read_sz && write_idx == 0;
+        return read_idx >= read_sz && pending_writes() == 0;
     }
 
     bool full() const noexcept
     {
-        std::size_t write_idx = write_index_.load(std::memory_order_acquire);
-        return write_idx >= capacity_;
+        return pending_writes() >= capacity_;
     }
-    
+
     std::size_t pending_writes() const noexcept
     {
-        return write_index_.load(std::memory_order_acquire);
+        return write_state_.load(std::memory_order_acquire) & ~SWAP_FLAG;
     }
-    
+
     std::size_t pending_reads() const noexcept
     {
         std::size_t idx = read_index_.load(std::memory_order_acquire);
@@ -178,4 +259,16 @@ public:
             return 0;
         return size - idx;
     }
+
+    // Most slots ever buffered at once (since construction)
+    std::size_t high_water() const noexcept
+    {
+        return high_water_.load(std::memory_order_relaxed);
+    }
+
+    // Flushes that had to spin before swapping
+    std::uint64_t flush_stalls() const noexcept
+    {
+        return flush_stalls_.load(std::memory_order_relaxed);
+    }
 };
@@ -0,0 +1,321 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// What happened to an order
+enum class EventKind : std::uint8_t
+{
+    Open,
+    Fill,
+    PartialFill,
+    Cancel,
+    Reject,
+    Modify
+};
+
+// Fixed-width journal record. Written as raw bytes, so the layout is the
+// on-disk format - append new fields at the end and bump JOURNAL_VERSION.
+struct JournalEvent
+{
+    std::uint64_t seq;       // Engine-assigned order sequence number
+    double price;
+    double qty;              // Filled qty for fills, resting qty otherwise
+    std::uint32_t order_id;
+    std::uint32_t ticker_id;
+    std::uint8_t kind;       // EventKind
+    std::uint8_t side;       // OrderSide
+    std::uint8_t type;       // OrderType
+    std::uint8_t pad_[5];
+};
+static_assert(sizeof(JournalEvent) == 40, "JournalEvent is the on-disk record layout");
+
+// Single-producer single-consumer ring of journal events. The producer is
+// the engine's owning worker, the consumer is the journal's drain thread.
+// Push is a bounds check, a struct copy and a release store - it never
+// blocks the matching path; overflow drops the event and counts it.
+class EventRing
+{
+public:
+    explicit EventRing(std::size_t capacity) noexcept
+    {
+        // Round up to a power of two so wrap-around is a mask
+        std::size_t cap = 1;
+        while (cap < capacity)
+            cap <<= 1;
+        buffer_.resize(cap);
+        mask_ = cap - 1;
+    }
+
+    bool try_push(const JournalEvent& event) noexcept
+    {
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        const std::uint64_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail > mask_)
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false; // Ring full - drain thread is behind
+        }
+        buffer_[head & mask_] = event;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(JournalEvent& out) noexcept
+    {
+        const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+        const std::uint64_t head = head_.load(std::memory_order_acquire);
+        if (tail == head)
+            return false;
+        out = buffer_[tail & mask_];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    std::uint64_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<JournalEvent> buffer_;
+    std::size_t mask_;
+    std::atomic<std::uint64_t> head_{0}; // Producer cursor
+    std::atomic<std::uint64_t> tail_{0}; // Consumer cursor
+    std::atomic<std::uint64_t> dropped_{0};
+};
+
+constexpr std::uint64_t JOURNAL_MAGIC = 0x4C4E4A4E41544954ULL; // "TITANJNL"
+constexpr std::uint32_t JOURNAL_VERSION = 1;
+
+struct JournalHeader
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t record_size;
+    std::uint64_t count; // Records in the file (written at close)
+};
+
+// Append-only binary event journal. Engines push fixed-width events into
+// per-engine SPSC rings; one dedicated I/O thread drains every ring into
+// a memory-mapped file that grows in large chunks. Decode offline with
+// JournalReader below.
+class EventJournal
+{
+public:
+    explicit EventJournal(const std::string& path, std::size_t ring_capacity = 1 << 16)
+    : path_(path), ring_capacity_(ring_capacity)
+    {
+        fd_ = ::open(path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+        if (fd_ < 0)
+            throw std::runtime_error("Journal Open Failed: " + path);
+
+        // Start with one chunk and grow by remapping as events accumulate
+        if (!remap(GROW_CHUNK))
+        {
+            ::close(fd_);
+            throw std::runtime_error("Journal Map Failed: " + path);
+        }
+
+        // Stamp the header; count is finalized at close
+        JournalHeader header{JOURNAL_MAGIC, JOURNAL_VERSION, sizeof(JournalEvent), 0};
+        std::memcpy(map_, &header, sizeof(header));
+
+        drain_thread_ = std::thread([this]() { drain_loop(); });
+    }
+
+    EventJournal(const EventJournal&) = delete;
+    EventJournal& operator=(const EventJournal&) = delete;
+
+    ~EventJournal() { close(); }
+
+    // Register a new producer; the returned ring stays valid for the
+    // journal's lifetime (engines hold the raw pointer)
+    EventRing* create_ring()
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        rings_.push_back(std::make_unique<EventRing>(ring_capacity_));
+        return rings_.back().get();
+    }
+
+    // Stop draining, flush everything and finalize the file
+    void close() noexcept
+    {
+        bool was_running = running_.exchange(false, std::memory_order_acq_rel);
+        if (!was_running)
+            return;
+
+        if (drain_thread_.joinable())
+            drain_thread_.join();
+
+        // Final header with the real record count, then trim the file
+        JournalHeader header{JOURNAL_MAGIC, JOURNAL_VERSION, sizeof(JournalEvent), count_};
+        std::memcpy(map_, &header, sizeof(header));
+        ::msync(map_, sizeof(header) + count_ * sizeof(JournalEvent), MS_SYNC);
+        ::munmap(map_, mapped_size_);
+        map_ = nullptr;
+        if (::ftruncate(fd_, sizeof(JournalHeader) + count_ * sizeof(JournalEvent)) != 0) { /* best effort */ }
+        ::close(fd_);
+        fd_ = -1;
+    }
+
+    // Events lost to full rings across all producers
+    std::uint64_t dropped_events() const noexcept
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        std::uint64_t total = 0;
+        for (const auto& ring : rings_)
+            total += ring->dropped();
+        return total;
+    }
+
+    std::uint64_t recorded_events() const noexcept { return count_; }
+
+private:
+    static constexpr std::size_t GROW_CHUNK = 16ull << 20; // Grow the mapping 16MB at a time
+
+    void drain_loop() noexcept
+    {
+        JournalEvent event;
+        while (running_.load(std::memory_order_acquire))
+        {
+            if (!drain_once(event))
+                std::this_thread::yield();
+        }
+        // Final sweep so no event queued before close() is lost
+        while (drain_once(event)) {}
+    }
+
+    bool drain_once(JournalEvent& event) noexcept
+    {
+        bool drained = false;
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        for (auto& ring : rings_)
+        {
+            while (ring->try_pop(event))
+            {
+                append(event);
+                drained = true;
+            }
+        }
+        return drained;
+    }
+
+    void append(const JournalEvent& event) noexcept
+    {
+        const std::size_t offset = sizeof(JournalHeader) + count_ * sizeof(JournalEvent);
+        if (offset + sizeof(JournalEvent) > mapped_size_)
+        {
+            if (!remap(mapped_size_ + GROW_CHUNK))
+                return; // Disk full - drop rather than crash the drain thread
+        }
+        std::memcpy(static_cast<char*>(map_) + offset, &event, sizeof(event));
+        ++count_;
+    }
+
+    bool remap(std::size_t new_size) noexcept
+    {
+        if (map_)
+            ::munmap(map_, mapped_size_);
+        if (::ftruncate(fd_, new_size) != 0)
+            return false;
+        map_ = ::mmap(nullptr, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (map_ == MAP_FAILED)
+        {
+            map_ = nullptr;
+            return false;
+        }
+        mapped_size_ = new_size;
+        return true;
+    }
+
+    std::string path_;
+    std::size_t ring_capacity_;
+    int fd_ = -1;
+    void* map_ = nullptr;
+    std::size_t mapped_size_ = 0;
+    std::uint64_t count_ = 0; // Records written (drain thread only)
+
+    mutable std::mutex rings_mutex_;
+    std::vector<std::unique_ptr<EventRing>> rings_;
+
+    std::thread drain_thread_;
+    std::atomic<bool> running_{true};
+};
+
+// Read-only view over a finalized journal file
+class JournalReader
+{
+public:
+    explicit JournalReader(const std::string& path)
+    {
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0)
+            throw std::runtime_error("Journal Open Failed: " + path);
+
+        struct stat st;
+        if (::fstat(fd_, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(JournalHeader))
+        {
+            ::close(fd_);
+            throw std::runtime_error("Journal Truncated: " + path);
+        }
+        size_ = st.st_size;
+
+        map_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (map_ == MAP_FAILED)
+        {
+            ::close(fd_);
+            throw std::runtime_error("Journal Map Failed: " + path);
+        }
+
+        JournalHeader header;
+        std::memcpy(&header, map_, sizeof(header));
+        if (header.magic != JOURNAL_MAGIC || header.version != JOURNAL_VERSION ||
+            header.record_size != sizeof(JournalEvent))
+        {
+            ::munmap(map_, size_);
+            ::close(fd_);
+            throw std::runtime_error("Journal Format Mismatch: " + path);
+        }
+        count_ = header.count;
+    }
+
+    JournalReader(const JournalReader&) = delete;
+    JournalReader& operator=(const JournalReader&) = delete;
+
+    ~JournalReader()
+    {
+        if (map_)
+            ::munmap(map_, size_);
+        if (fd_ >= 0)
+            ::close(fd_);
+    }
+
+    std::size_t size() const noexcept { return count_; }
+
+    const JournalEvent& operator[](std::size_t idx) const noexcept
+    {
+        return events()[idx];
+    }
+
+    const JournalEvent* begin() const noexcept { return events(); }
+    const JournalEvent* end() const noexcept { return events() + count_; }
+
+private:
+    const JournalEvent* events() const noexcept
+    {
+        return reinterpret_cast<const JournalEvent*>(static_cast<const char*>(map_) + sizeof(JournalHeader));
+    }
+
+    int fd_ = -1;
+    void* map_ = nullptr;
+    std::size_t size_ = 0;
+    std::uint64_t count_ = 0;
+};